@@ -0,0 +1,294 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Benchmark/SolidBenchmark.h"
+
+#include "Dom/JsonObject.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include "SolidMacros.h"
+
+namespace Solid::Benchmark::Private
+{
+	void UseCharPointer(const volatile char* Pointer)
+	{
+	}
+
+	// Nearest-rank percentile over a sorted array
+	static double GetPercentile(const TArray<double>& Sorted, const double Percentile)
+	{
+		solid_cassume(!Sorted.IsEmpty());
+
+		const int32 Rank = FMath::CeilToInt32(Percentile * Sorted.Num());
+		return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+	}
+
+	static TSharedRef<FJsonObject> ResultToJson(const FBenchmarkResult& Result)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("name"), Result.Name);
+		Object->SetNumberField(TEXT("iterations_per_sample"), static_cast<double>(Result.IterationsPerSample));
+		Object->SetNumberField(TEXT("samples"), Result.NumSamples);
+		Object->SetNumberField(TEXT("min_ns"), Result.MinNs);
+		Object->SetNumberField(TEXT("max_ns"), Result.MaxNs);
+		Object->SetNumberField(TEXT("mean_ns"), Result.MeanNs);
+		Object->SetNumberField(TEXT("median_ns"), Result.MedianNs);
+		Object->SetNumberField(TEXT("p95_ns"), Result.P95Ns);
+		Object->SetNumberField(TEXT("p99_ns"), Result.P99Ns);
+		Object->SetNumberField(TEXT("stddev_ns"), Result.StdDevNs);
+		Object->SetNumberField(TEXT("median_cycles"), Result.MedianCycles);
+		return Object;
+	}
+
+	static FBenchmarkResult ResultFromJson(const FJsonObject& Object)
+	{
+		FBenchmarkResult Result;
+		Result.Name = Object.GetStringField(TEXT("name"));
+		Result.IterationsPerSample = static_cast<int64>(Object.GetNumberField(TEXT("iterations_per_sample")));
+		Result.NumSamples = static_cast<int32>(Object.GetNumberField(TEXT("samples")));
+		Result.MinNs = Object.GetNumberField(TEXT("min_ns"));
+		Result.MaxNs = Object.GetNumberField(TEXT("max_ns"));
+		Result.MeanNs = Object.GetNumberField(TEXT("mean_ns"));
+		Result.MedianNs = Object.GetNumberField(TEXT("median_ns"));
+		Result.P95Ns = Object.GetNumberField(TEXT("p95_ns"));
+		Result.P99Ns = Object.GetNumberField(TEXT("p99_ns"));
+		Result.StdDevNs = Object.GetNumberField(TEXT("stddev_ns"));
+		Result.MedianCycles = Object.GetNumberField(TEXT("median_cycles"));
+		return Result;
+	}
+
+	static FString SerializeJson(const TSharedRef<FJsonObject>& Object)
+	{
+		FString Output;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		FJsonSerializer::Serialize(Object, Writer);
+		return Output;
+	}
+
+	// Names become file names, keep them portable
+	static FString SanitizeFileName(const FString& Name)
+	{
+		FString Sanitized = Name;
+
+		for (TCHAR& Character : Sanitized)
+		{
+			if (!FChar::IsAlnum(Character) && Character != TEXT('.') && Character != TEXT('_') && Character != TEXT('-'))
+			{
+				Character = TEXT('_');
+			}
+		}
+
+		return Sanitized;
+	}
+
+} // namespace Solid::Benchmark::Private
+
+Solid::Benchmark::FBenchmarkResult Solid::Benchmark::FBenchmarkResult::FromSamples(const FString& InName,
+	TArray<uint64> SampleCycles, const int64 InIterationsPerSample)
+{
+	FBenchmarkResult Result;
+	Result.Name = InName;
+	Result.IterationsPerSample = InIterationsPerSample;
+	Result.NumSamples = SampleCycles.Num();
+
+	if UNLIKELY_IF(SampleCycles.IsEmpty() || InIterationsPerSample <= 0)
+	{
+		return Result;
+	}
+
+	SampleCycles.Sort();
+
+	const double NanosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1e9;
+	const double Iterations = static_cast<double>(InIterationsPerSample);
+
+	TArray<double> Nanoseconds;
+	Nanoseconds.Reserve(SampleCycles.Num());
+
+	double Sum = 0.0;
+
+	for (const uint64 Cycles : SampleCycles)
+	{
+		const double SampleNs = static_cast<double>(Cycles) * NanosecondsPerCycle / Iterations;
+		Nanoseconds.Add(SampleNs);
+		Sum += SampleNs;
+	}
+
+	Result.MinNs = Nanoseconds[0];
+	Result.MaxNs = Nanoseconds.Last();
+	Result.MeanNs = Sum / Nanoseconds.Num();
+	Result.MedianNs = Private::GetPercentile(Nanoseconds, 0.50);
+	Result.P95Ns = Private::GetPercentile(Nanoseconds, 0.95);
+	Result.P99Ns = Private::GetPercentile(Nanoseconds, 0.99);
+
+	if (Nanoseconds.Num() > 1)
+	{
+		double SquaredDeviations = 0.0;
+
+		for (const double SampleNs : Nanoseconds)
+		{
+			SquaredDeviations += FMath::Square(SampleNs - Result.MeanNs);
+		}
+
+		Result.StdDevNs = FMath::Sqrt(SquaredDeviations / (Nanoseconds.Num() - 1));
+	}
+
+	const int32 MedianIndex = FMath::Clamp(FMath::CeilToInt32(0.5 * SampleCycles.Num()) - 1, 0, SampleCycles.Num() - 1);
+	Result.MedianCycles = static_cast<double>(SampleCycles[MedianIndex]) / Iterations;
+
+	return Result;
+}
+
+FString Solid::Benchmark::ToJson(const TConstArrayView<FBenchmarkResult> Results)
+{
+	TArray<TSharedPtr<FJsonValue>> Values;
+	Values.Reserve(Results.Num());
+
+	for (const FBenchmarkResult& Result : Results)
+	{
+		Values.Add(MakeShared<FJsonValueObject>(Private::ResultToJson(Result)));
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetArrayField(TEXT("benchmarks"), Values);
+
+	return Private::SerializeJson(Root);
+}
+
+FString Solid::Benchmark::ToCsv(const TConstArrayView<FBenchmarkResult> Results)
+{
+	FString Output = TEXT("name,iterations_per_sample,samples,min_ns,max_ns,mean_ns,median_ns,p95_ns,p99_ns,stddev_ns,median_cycles\n");
+
+	for (const FBenchmarkResult& Result : Results)
+	{
+		Output += FString::Printf(TEXT("\"%s\",%lld,%d,%f,%f,%f,%f,%f,%f,%f,%f\n"),
+			*Result.Name.Replace(TEXT("\""), TEXT("\"\"")), Result.IterationsPerSample, Result.NumSamples,
+			Result.MinNs, Result.MaxNs, Result.MeanNs, Result.MedianNs, Result.P95Ns, Result.P99Ns,
+			Result.StdDevNs, Result.MedianCycles);
+	}
+
+	return Output;
+}
+
+bool Solid::Benchmark::SaveReport(const FString& FilePath, const TConstArrayView<FBenchmarkResult> Results,
+	const EBenchmarkReportFormat Format)
+{
+	const FString Contents = Format == EBenchmarkReportFormat::Json ? ToJson(Results) : ToCsv(Results);
+	return FFileHelper::SaveStringToFile(Contents, *FilePath);
+}
+
+void Solid::Benchmark::LogResult(const FBenchmarkResult& Result)
+{
+	UE_LOGFMT(LogSolidMacros, Display,
+		"Benchmark '{Name}': median {Median} ns, p95 {P95} ns, p99 {P99} ns, mean {Mean} ns, stddev {StdDev} ns, "
+		"min {Min} ns, max {Max} ns, {Cycles} cycles ({Samples} samples x {Iterations} iterations)",
+		Result.Name, Result.MedianNs, Result.P95Ns, Result.P99Ns, Result.MeanNs, Result.StdDevNs,
+		Result.MinNs, Result.MaxNs, Result.MedianCycles, Result.NumSamples, Result.IterationsPerSample);
+}
+
+FString Solid::Benchmark::GetBenchmarkDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SolidBenchmarks"));
+}
+
+FString Solid::Benchmark::GetBaselinePath(const FString& Name)
+{
+	return FPaths::Combine(GetBenchmarkDirectory(), TEXT("Baselines"), Private::SanitizeFileName(Name) + TEXT(".json"));
+}
+
+TOptional<Solid::Benchmark::FBenchmarkResult> Solid::Benchmark::LoadBaseline(const FString& Name)
+{
+	FString Contents;
+
+	if (!FFileHelper::LoadFileToString(Contents, *GetBaselinePath(Name)))
+	{
+		return {};
+	}
+
+	TSharedPtr<FJsonObject> Object;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Contents);
+
+	if UNLIKELY_IF(!FJsonSerializer::Deserialize(Reader, Object) || !Object.IsValid())
+	{
+		UE_LOGFMT(LogSolidMacros, Warning, "Failed to parse benchmark baseline '{Path}'", GetBaselinePath(Name));
+		return {};
+	}
+
+	return Private::ResultFromJson(*Object);
+}
+
+bool Solid::Benchmark::SaveBaseline(const FBenchmarkResult& Result)
+{
+	return FFileHelper::SaveStringToFile(Private::SerializeJson(Private::ResultToJson(Result)), *GetBaselinePath(Result.Name));
+}
+
+Solid::Benchmark::FBenchmarkComparison Solid::Benchmark::CompareToBaseline(const FBenchmarkResult& Result,
+	const FBenchmarkResult& Baseline, const double RegressionThreshold)
+{
+	FBenchmarkComparison Comparison;
+	Comparison.BaselineMedianNs = Baseline.MedianNs;
+	Comparison.CurrentMedianNs = Result.MedianNs;
+
+	if (Baseline.MedianNs > 0.0)
+	{
+		Comparison.RelativeChange = (Result.MedianNs - Baseline.MedianNs) / Baseline.MedianNs;
+		Comparison.bRegressed = Comparison.RelativeChange > RegressionThreshold;
+	}
+
+	return Comparison;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+Solid::Benchmark::FBenchmarkContext::FBenchmarkContext(FAutomationTestBase& InTest, const FString& InSuiteName)
+	: Test(InTest)
+	, SuiteName(InSuiteName)
+{
+}
+
+const Solid::Benchmark::FBenchmarkResult& Solid::Benchmark::FBenchmarkContext::Record(FBenchmarkResult&& Result,
+	const FBenchmarkSettings& Settings)
+{
+	LogResult(Result);
+
+	const bool bUpdateBaseline = FParse::Param(FCommandLine::Get(), TEXT("SolidBenchmarkUpdateBaseline"));
+
+	if (const TOptional<FBenchmarkResult> Baseline = LoadBaseline(Result.Name); Baseline.IsSet() && !bUpdateBaseline)
+	{
+		const FBenchmarkComparison Comparison = CompareToBaseline(Result, Baseline.GetValue(), Settings.RegressionThreshold);
+
+		const FString Message = FString::Printf(TEXT("%s: median %.2f ns vs baseline %.2f ns (%+.1f%%)"),
+			*Result.Name, Comparison.CurrentMedianNs, Comparison.BaselineMedianNs, Comparison.RelativeChange * 100.0);
+
+		if (Comparison.bRegressed)
+		{
+			Test.AddError(FString::Printf(TEXT("Regression above %.1f%%: %s"), Settings.RegressionThreshold * 100.0, *Message));
+		}
+		else
+		{
+			Test.AddInfo(Message);
+		}
+	}
+	else
+	{
+		SaveBaseline(Result);
+		Test.AddInfo(FString::Printf(TEXT("%s: saved baseline, median %.2f ns"), *Result.Name, Result.MedianNs));
+	}
+
+	return Results.Add_GetRef(MoveTemp(Result));
+}
+
+bool Solid::Benchmark::FBenchmarkContext::Finish()
+{
+	const FString ReportPath = FPaths::Combine(GetBenchmarkDirectory(), TEXT("Reports"), Private::SanitizeFileName(SuiteName));
+
+	SaveReport(ReportPath + TEXT(".json"), Results, EBenchmarkReportFormat::Json);
+	SaveReport(ReportPath + TEXT(".csv"), Results, EBenchmarkReportFormat::Csv);
+
+	return !Test.HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,252 @@
+// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Benchmark/SolidBenchmark.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Logging/StructuredLog.h"
+
+#include "SolidMacros.h"
+#include "Standard/For.h"
+#include "Standard/ParallelFor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Solid::ForBenchmark::Private
+{
+	// A few flops per element, enough that small ranges are not pure loop overhead
+	FORCEINLINE float Kernel(const float Value)
+	{
+		return FMath::Sqrt(Value * Value + 1.0f) * 0.5f + Value;
+	}
+
+	static TArray<float> MakeInput(const int32 Num)
+	{
+		TArray<float> Input;
+		Input.SetNumUninitialized(Num);
+
+		For(Num, [&Input](const int32 Index)
+		{
+			Input[Index] = static_cast<float>(Index % 1024) * 0.25f;
+		});
+
+		return Input;
+	}
+
+	// Contracting, so the values stay finite and in range however many runs rewrite the array in place
+	template <typename T>
+	FORCEINLINE T Step(const T Value)
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			return Value * static_cast<T>(0.5) + static_cast<T>(1);
+		}
+		else
+		{
+			return (Value >> 1) + static_cast<T>(1);
+		}
+	}
+
+	/**
+	 * In place and Dest from Source passes over an array small enough to stay in L1/L2, so the loop body
+	 * rather than memory bandwidth is measured. For is the index based baseline over raw pointers.
+	 */
+	template <typename T>
+	static void CompareUnrolledLoops(Benchmark::FBenchmarkContext& Context, const TCHAR* TypeName)
+	{
+		constexpr int32 Num = 16 * 1024 + 3;
+
+		TArray<T> Data;
+		Data.Init(static_cast<T>(3), Num);
+
+		TArray<T> Source;
+		Source.Init(static_cast<T>(5), Num);
+
+		T* DataPointer = Data.GetData();
+		const T* SourcePointer = Source.GetData();
+
+		Context.Run(FString::Printf(TEXT("%s.InPlace.For"), TypeName), [&]()
+		{
+			For(Num, [DataPointer](const int32 Index)
+			{
+				DataPointer[Index] = Step(DataPointer[Index]);
+			});
+
+			Benchmark::DoNotOptimize(DataPointer[Num - 1]);
+		});
+
+		Context.Run(FString::Printf(TEXT("%s.InPlace.ForUnrolled4"), TypeName), [&]()
+		{
+			ForUnrolled<4>(Data, [](T& Value) { Value = Step(Value); });
+			Benchmark::DoNotOptimize(DataPointer[Num - 1]);
+		});
+
+		Context.Run(FString::Printf(TEXT("%s.InPlace.ForUnrolled8"), TypeName), [&]()
+		{
+			ForUnrolled<8>(Data, [](T& Value) { Value = Step(Value); });
+			Benchmark::DoNotOptimize(DataPointer[Num - 1]);
+		});
+
+		Context.Run(FString::Printf(TEXT("%s.InPlace.ForStrided8"), TypeName), [&]()
+		{
+			ForStrided<8>(Data, [](T* SOLID_RESTRICT Batch, const auto Width)
+			{
+				for (std::size_t Lane = 0; Lane < Width; ++Lane)
+				{
+					Batch[Lane] = Step(Batch[Lane]);
+				}
+			});
+
+			Benchmark::DoNotOptimize(DataPointer[Num - 1]);
+		});
+
+		// without restrict the compiler has to prove at run time that Dest and Source do not overlap
+		Context.Run(FString::Printf(TEXT("%s.DestSource.For"), TypeName), [&]()
+		{
+			For(Num, [DataPointer, SourcePointer](const int32 Index)
+			{
+				DataPointer[Index] = Step(SourcePointer[Index]);
+			});
+
+			Benchmark::DoNotOptimize(DataPointer[Num - 1]);
+		});
+
+		Context.Run(FString::Printf(TEXT("%s.DestSource.ForUnrolled8"), TypeName), [&]()
+		{
+			ForUnrolled<8>(Data, Source, [](T& Dest, const T& Value) { Dest = Step(Value); });
+			Benchmark::DoNotOptimize(DataPointer[Num - 1]);
+		});
+	}
+
+} // namespace Solid::ForBenchmark::Private
+
+// ParallelFor against For over a sweep of element counts and worker counts, to place FParallelForSettings::SerialThreshold.
+// SerialThreshold is lowered to 1 so the small counts are really split instead of falling back to the serial loop.
+SOLID_BENCHMARK_TEST(ParallelForScaling)
+{
+	using namespace Solid::ForBenchmark::Private;
+
+	Solid::Benchmark::FBenchmarkSettings Settings;
+	Settings.NumSamples = 15;
+
+	// powers of two, then every worker the task graph has plus the calling thread
+	TArray<int32> WorkerCounts;
+	const int32 MaxWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	for (int32 NumWorkers = 1; NumWorkers < MaxWorkers; NumWorkers *= 2)
+	{
+		WorkerCounts.Add(NumWorkers);
+	}
+
+	WorkerCounts.Add(MaxWorkers);
+
+	for (int32 Num = 256; Num <= 4 * 1024 * 1024; Num *= 8)
+	{
+		const TArray<float> Input = MakeInput(Num);
+
+		TArray<float> Output;
+		Output.SetNumUninitialized(Num);
+
+		const float* InputData = Input.GetData();
+		float* OutputData = Output.GetData();
+
+		const double SerialNs = Context.Run(FString::Printf(TEXT("For.%d"), Num), [&]()
+		{
+			Solid::For(Num, [InputData, OutputData](const int32 Index)
+			{
+				OutputData[Index] = Kernel(InputData[Index]);
+			});
+
+			Solid::Benchmark::DoNotOptimize(OutputData[Num - 1]);
+		}, Settings).MedianNs;
+
+		for (const int32 NumWorkers : WorkerCounts)
+		{
+			Solid::FParallelForSettings ParallelSettings;
+			ParallelSettings.SerialThreshold = 1;
+			ParallelSettings.MaxWorkers = NumWorkers;
+
+			const double ParallelNs = Context.Run(FString::Printf(TEXT("ParallelFor.%d.Workers%d"), Num, NumWorkers), [&]()
+			{
+				Solid::ParallelFor(Num, [InputData, OutputData](const int32 Index)
+				{
+					OutputData[Index] = Kernel(InputData[Index]);
+				}, ParallelSettings);
+
+				Solid::Benchmark::DoNotOptimize(OutputData[Num - 1]);
+			}, Settings).MedianNs;
+
+			UE_LOGFMT(LogSolidMacros, Display, "ParallelFor {Num} elements on {Workers} workers: {Speedup}x of For",
+				Num, NumWorkers, SerialNs / FMath::Max(ParallelNs, UE_DOUBLE_SMALL_NUMBER));
+		}
+	}
+}
+
+// ForUnrolled and ForStrided against a plain For, whether they vectorize is best confirmed in the compiler's vectorization report
+SOLID_BENCHMARK_TEST(ForUnrolled)
+{
+	using namespace Solid::ForBenchmark::Private;
+
+	CompareUnrolledLoops<float>(Context, TEXT("float"));
+	CompareUnrolledLoops<int32>(Context, TEXT("int32"));
+}
+
+// ParallelForZip against the indexed loops it replaces, serial and through ParallelFor, over the same integration step
+SOLID_BENCHMARK_TEST(ParallelForZip)
+{
+	constexpr int32 Num = 1024 * 1024;
+	constexpr float DeltaTime = 1.0f / 60.0f;
+
+	TArray<float> Positions;
+	Positions.Init(0.0f, Num);
+
+	TArray<float> Velocities;
+	Velocities.Init(1.0f, Num);
+
+	float* PositionData = Positions.GetData();
+	const float* VelocityData = Velocities.GetData();
+
+	Solid::Benchmark::FBenchmarkSettings Settings;
+	Settings.NumSamples = 15;
+
+	Context.Run(TEXT("Indexed.Serial"), [&]()
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			PositionData[Index] += VelocityData[Index] * DeltaTime;
+		}
+
+		Solid::Benchmark::DoNotOptimize(PositionData[Num - 1]);
+	}, Settings);
+
+	Context.Run(TEXT("Indexed.ParallelFor"), [&]()
+	{
+		Solid::ParallelFor(Num, [PositionData, VelocityData](const int32 Index)
+		{
+			PositionData[Index] += VelocityData[Index] * DeltaTime;
+		});
+
+		Solid::Benchmark::DoNotOptimize(PositionData[Num - 1]);
+	}, Settings);
+
+	Context.Run(TEXT("ForZip"), [&]()
+	{
+		Solid::ForZip(Positions, Velocities, [](const int32, float& Position, const float& Velocity)
+		{
+			Position += Velocity * DeltaTime;
+		});
+
+		Solid::Benchmark::DoNotOptimize(PositionData[Num - 1]);
+	}, Settings);
+
+	Context.Run(TEXT("ParallelForZip"), [&]()
+	{
+		Solid::ParallelForZip(Positions, Velocities, [](const int32, float& Position, const float& Velocity)
+		{
+			Position += Velocity * DeltaTime;
+		});
+
+		Solid::Benchmark::DoNotOptimize(PositionData[Num - 1]);
+	}, Settings);
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,180 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Benchmark/SolidBenchmark.h"
+
+#include "GameplayTagContainer.h"
+#include "Logging/StructuredLog.h"
+#include "UObject/SoftObjectPath.h"
+
+#include "SolidMacros.h"
+#include "Types/SolidCppStructOpsParallel.h"
+#include "Types/SolidInstancedStructOps.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Solid::StructOpsBenchmark::Private
+{
+	// Two buffers of Count elements, the live values bounce between them so every run moves the same data
+	struct FPingPongBuffers
+	{
+		FPingPongBuffers(const FSolidStructOpsHandle InHandle, const uint32 InCount)
+			: Handle(InHandle)
+			, Count(InCount)
+		{
+			const SIZE_T Bytes = static_cast<SIZE_T>(Count) * FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle).Size;
+
+			Live = FMemory::Malloc(Bytes, SOLID_CACHE_LINE_SIZE);
+			Spare = FMemory::Malloc(Bytes, SOLID_CACHE_LINE_SIZE);
+
+			DefaultConstructScriptStruct(Handle, Live, Count);
+		}
+
+		~FPingPongBuffers()
+		{
+			DestroyScriptStruct(Handle, Live, Count);
+
+			FMemory::Free(Live);
+			FMemory::Free(Spare);
+		}
+
+		UE_NONCOPYABLE(FPingPongBuffers);
+
+		// Spare now holds the values, the moved-from ones left in Live are destroyed
+		FORCEINLINE void Flip()
+		{
+			DestroyScriptStruct(Handle, Live, Count);
+			Swap(Live, Spare);
+		}
+
+		FSolidStructOpsHandle Handle;
+		uint32 Count;
+
+		void* Live;
+		void* Spare;
+	}; // struct FPingPongBuffers
+
+	// Engine structs, registered here rather than with DEFINE_SOLID_MOVEABLE_CPP_STRUCT so only benchmark runs pay for them
+	template <typename TStructType>
+	static FSolidStructOpsHandle FindOrRegisterHandle()
+	{
+		FSolidStructOpsHandle Handle = FSolidMoveableStructRegistry::Get().FindHandle(TBaseStructure<TStructType>::Get());
+
+		if (!Handle.IsValid())
+		{
+			FSolidMoveableStructRegistry::Get().RegisterMovableScriptStruct<TStructType>();
+			Handle = FSolidMoveableStructRegistry::Get().FindHandle(TBaseStructure<TStructType>::Get());
+		}
+
+		return Handle;
+	}
+
+	template <typename TStructType>
+	static void SweepParallelMove(Benchmark::FBenchmarkContext& Context, const TCHAR* TypeName)
+	{
+		const FSolidStructOpsHandle Handle = FindOrRegisterHandle<TStructType>();
+		const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo = FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle);
+
+		Benchmark::FBenchmarkSettings Settings;
+		Settings.NumSamples = 15;
+
+		TOptional<SIZE_T> CrossoverBytes;
+
+		for (uint32 Count = 1024; Count <= 1024 * 1024; Count *= 4)
+		{
+			FPingPongBuffers Buffers(Handle, Count);
+
+			const double SerialNs = Context.Run(FString::Printf(TEXT("%s.Serial.%u"), TypeName, Count), [&]()
+			{
+				Solid::Private::MoveConstructScriptStruct(TypeHookInfo, Buffers.Spare, Buffers.Live, Count);
+				Buffers.Flip();
+			}, Settings).MedianNs;
+
+			const double ParallelNs = Context.Run(FString::Printf(TEXT("%s.Parallel.%u"), TypeName, Count), [&]()
+			{
+				Solid::Private::MoveConstructScriptStructChunked(TypeHookInfo, Buffers.Spare, Buffers.Live, Count, FParallelForSettings());
+				Buffers.Flip();
+			}, Settings).MedianNs;
+
+			if (!CrossoverBytes.IsSet() && ParallelNs < SerialNs)
+			{
+				CrossoverBytes = static_cast<SIZE_T>(Count) * TypeHookInfo.Size;
+			}
+		}
+
+		if (CrossoverBytes.IsSet())
+		{
+			UE_LOGFMT(LogSolidMacros, Display, "{Type}: parallel moves win from {KiB} KiB, Solid.StructOps.ParallelMoveThreshold is {Current} KiB",
+				TypeName, *CrossoverBytes / 1024, Solid::Private::GetParallelStructMoveThresholdBytes() / 1024);
+		}
+		else
+		{
+			UE_LOGFMT(LogSolidMacros, Display, "{Type}: parallel moves never won in the sweep", TypeName);
+		}
+	}
+
+	/**
+	 * Each run builds a fresh value in Source and stores it into Dest, which already holds one, the way
+	 * gameplay code reassigns instanced structs. Copy is FInstancedStruct's copy assignment, Adopt is
+	 * FInstancedStruct's move assignment, the fallback of MoveInstancedStruct, and InPlace is
+	 * MoveInstancedStruct's registry move assignment into Dest's payload.
+	 */
+	template <typename TStructType>
+	static void CompareInstancedStructMoves(Benchmark::FBenchmarkContext& Context, const TCHAR* TypeName, const TStructType& Value)
+	{
+		// registered so MoveInstancedStruct takes its in place path
+		FindOrRegisterHandle<TStructType>();
+
+		FInstancedStruct Dest = FInstancedStruct::Make(Value);
+		FInstancedStruct Source = FInstancedStruct::Make(Value);
+
+		Context.Run(FString::Printf(TEXT("%s.Copy"), TypeName), [&]()
+		{
+			Source.GetMutable<TStructType>() = Value;
+			Dest = Source;
+			Benchmark::DoNotOptimize(Dest);
+		});
+
+		// both moves leave Source empty, so both pay for building into it again
+		Context.Run(FString::Printf(TEXT("%s.Adopt"), TypeName), [&]()
+		{
+			Source.InitializeAs<TStructType>(Value);
+			Dest = MoveTemp(Source);
+			Benchmark::DoNotOptimize(Dest);
+		});
+
+		Context.Run(FString::Printf(TEXT("%s.InPlace"), TypeName), [&]()
+		{
+			Source.InitializeAs<TStructType>(Value);
+			MoveInstancedStruct(Dest, Source);
+			Benchmark::DoNotOptimize(Dest);
+		});
+	}
+
+} // namespace Solid::StructOpsBenchmark::Private
+
+// Serial against chunked parallel MoveConstructScriptStruct, to place Solid.StructOps.ParallelMoveThreshold.
+// The destroy of the moved-from batch is serial and identical in both.
+SOLID_BENCHMARK_TEST(StructMoveParallel)
+{
+	using namespace Solid::StructOpsBenchmark::Private;
+
+	// trivially copyable, a single memcpy per chunk
+	SweepParallelMove<FVector>(Context, TEXT("FVector"));
+
+	// non trivial, one indirect call per chunk and a real move constructor per element
+	SweepParallelMove<FGameplayTagContainer>(Context, TEXT("FGameplayTagContainer"));
+}
+
+// MoveInstancedStruct's in place registry move against FInstancedStruct's copy and move assignment
+SOLID_BENCHMARK_TEST(InstancedStructMove)
+{
+	using namespace Solid::StructOpsBenchmark::Private;
+
+	CompareInstancedStructMoves(Context, TEXT("FVector"), FVector(1.0, 2.0, 3.0));
+
+	// heap owning payload, the sub path string is what copies have to duplicate
+	CompareInstancedStructMoves(Context, TEXT("FSoftObjectPath"),
+		FSoftObjectPath(TEXT("/Game/Benchmarks/SolidStructOps.SolidStructOps:PersistentLevel.BenchmarkActor.BenchmarkComponent")));
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
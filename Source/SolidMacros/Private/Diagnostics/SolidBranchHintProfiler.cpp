@@ -0,0 +1,208 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Diagnostics/SolidBranchHintProfiler.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Logging/StructuredLog.h"
+
+#include "SolidMacros.h"
+
+namespace Solid::BranchHints::Private
+{
+	struct FRegistry
+	{
+		FCriticalSection CriticalSection;
+
+		TArray<const FSite*> Sites;
+
+		// Kept alive after their thread exits so the counts survive until the next dump
+		TArray<TUniquePtr<FThreadCounters>> Threads;
+	}; // struct FRegistry
+
+	static FRegistry& GetRegistry()
+	{
+		static FRegistry Registry;
+		return Registry;
+	}
+
+	FThreadCounters& CreateThreadCounters()
+	{
+		FRegistry& Registry = GetRegistry();
+
+		TUniquePtr<FThreadCounters> Counters = MakeUnique<FThreadCounters>();
+
+		for (std::atomic<FCounterPage*>& Page : Counters->Pages)
+		{
+			Page.store(nullptr, std::memory_order_relaxed);
+		}
+
+		FThreadCounters& Result = *Counters;
+
+		FScopeLock Lock(&Registry.CriticalSection);
+		Registry.Threads.Add(MoveTemp(Counters));
+
+		return Result;
+	}
+
+	FCounterPage& CreateCounterPage(FThreadCounters& Counters, const int32 PageIndex)
+	{
+		FCounterPage* Page = new FCounterPage;
+
+		for (int32 Index = 0; Index < SitesPerPage; ++Index)
+		{
+			Page->Taken[Index].store(0, std::memory_order_relaxed);
+			Page->NotTaken[Index].store(0, std::memory_order_relaxed);
+		}
+
+		// release so a concurrent dump never sees the page before its counters are zeroed
+		Counters.Pages[PageIndex].store(Page, std::memory_order_release);
+
+		return *Page;
+	}
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("Solid.BranchHints.Dump"),
+		TEXT("Logs LIKELY/UNLIKELY sites whose hint disagrees with the observed outcome. ")
+		TEXT("Arguments: [MispredictThreshold=0.5] [MinSamples=1000]. Requires SOLID_PROFILE_BRANCH_HINTS=1."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			double Threshold = 0.5;
+			uint64 MinSamples = 1000;
+
+			if (Args.IsValidIndex(0))
+			{
+				LexFromString(Threshold, *Args[0]);
+			}
+
+			if (Args.IsValidIndex(1))
+			{
+				LexFromString(MinSamples, *Args[1]);
+			}
+
+			Dump(Threshold, MinSamples);
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("Solid.BranchHints.Reset"),
+		TEXT("Clears the branch hint counters."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			Reset();
+		}));
+
+	template <typename FunctionType>
+	static void ForEachPage(FRegistry& Registry, FunctionType Function)
+	{
+		for (const TUniquePtr<FThreadCounters>& Counters : Registry.Threads)
+		{
+			for (int32 PageIndex = 0; PageIndex < MaxPages; ++PageIndex)
+			{
+				if (FCounterPage* Page = Counters->Pages[PageIndex].load(std::memory_order_acquire))
+				{
+					Function(PageIndex, *Page);
+				}
+			}
+		}
+	}
+
+} // namespace Solid::BranchHints::Private
+
+Solid::BranchHints::FSite::FSite(const ANSICHAR* InFile, const int32 InLine, const bool bInExpected)
+	: File(InFile)
+	, Line(InLine)
+	, bExpected(bInExpected)
+	, Index(INDEX_NONE)
+{
+	Private::FRegistry& Registry = Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+
+	if (Registry.Sites.Num() < MaxSites)
+	{
+		Index = Registry.Sites.Add(this);
+	}
+}
+
+void Solid::BranchHints::Dump(const double MispredictThreshold, const uint64 MinSamples)
+{
+	Private::FRegistry& Registry = Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+
+	TArray<uint64> Taken;
+	TArray<uint64> NotTaken;
+	Taken.SetNumZeroed(Registry.Sites.Num());
+	NotTaken.SetNumZeroed(Registry.Sites.Num());
+
+	Private::ForEachPage(Registry, [&Taken, &NotTaken](const int32 PageIndex, const Private::FCounterPage& Page)
+	{
+		const int32 FirstSite = PageIndex * SitesPerPage;
+		const int32 NumSites = FMath::Min(SitesPerPage, Taken.Num() - FirstSite);
+
+		for (int32 Slot = 0; Slot < NumSites; ++Slot)
+		{
+			Taken[FirstSite + Slot] += Page.Taken[Slot].load(std::memory_order_relaxed);
+			NotTaken[FirstSite + Slot] += Page.NotTaken[Slot].load(std::memory_order_relaxed);
+		}
+	});
+
+	struct FMispredictedSite
+	{
+		const FSite* Site = nullptr;
+		uint64 Samples = 0;
+		uint64 Mispredicted = 0;
+	}; // struct FMispredictedSite
+
+	TArray<FMispredictedSite> Mispredicted;
+
+	for (int32 SiteIndex = 0; SiteIndex < Registry.Sites.Num(); ++SiteIndex)
+	{
+		const FSite* Site = Registry.Sites[SiteIndex];
+		const uint64 Samples = Taken[SiteIndex] + NotTaken[SiteIndex];
+
+		if (Samples < MinSamples || Samples == 0)
+		{
+			continue;
+		}
+
+		const uint64 Wrong = Site->bExpected ? NotTaken[SiteIndex] : Taken[SiteIndex];
+
+		if (static_cast<double>(Wrong) / static_cast<double>(Samples) > MispredictThreshold)
+		{
+			Mispredicted.Add({ Site, Samples, Wrong });
+		}
+	}
+
+	Mispredicted.Sort([](const FMispredictedSite& A, const FMispredictedSite& B)
+	{
+		return A.Mispredicted > B.Mispredicted;
+	});
+
+	UE_LOGFMT(LogSolidMacros, Display, "Branch hints: {Num} of {Total} sites disagree with their hint above {Threshold}",
+		Mispredicted.Num(), Registry.Sites.Num(), MispredictThreshold);
+
+	for (const FMispredictedSite& Entry : Mispredicted)
+	{
+		UE_LOGFMT(LogSolidMacros, Display, "  {File}({Line}): hinted {Hint}, against the hint {Wrong} of {Samples} times ({Percent}%)",
+			ANSI_TO_TCHAR(Entry.Site->File), Entry.Site->Line, Entry.Site->bExpected ? TEXT("LIKELY") : TEXT("UNLIKELY"),
+			Entry.Mispredicted, Entry.Samples,
+			100.0 * static_cast<double>(Entry.Mispredicted) / static_cast<double>(Entry.Samples));
+	}
+}
+
+void Solid::BranchHints::Reset()
+{
+	Private::FRegistry& Registry = Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+
+	// racing increments from the owning threads may survive, which is fine for profiling
+	Private::ForEachPage(Registry, [](const int32 PageIndex, Private::FCounterPage& Page)
+	{
+		for (int32 Slot = 0; Slot < SitesPerPage; ++Slot)
+		{
+			Page.Taken[Slot].store(0, std::memory_order_relaxed);
+			Page.NotTaken[Slot].store(0, std::memory_order_relaxed);
+		}
+	});
+}
@@ -0,0 +1,100 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Diagnostics/SolidCheckProfiler.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Logging/StructuredLog.h"
+
+#include "SolidMacros.h"
+
+namespace Solid::CheckProfiler::Private
+{
+	static std::atomic<FCheckSite*> SiteListHead { nullptr };
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("Solid.Checks.Dump"),
+		TEXT("Logs the most evaluated solid_check/solid_cassume sites, or the most expensive with SOLID_PROFILE_CHECK_CYCLES=1. Arguments: [NumSites=20]. Requires SOLID_PROFILE_CHECKS=1."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			int32 NumSites = 20;
+
+			if (Args.IsValidIndex(0))
+			{
+				LexFromString(NumSites, *Args[0]);
+			}
+
+			Dump(NumSites);
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("Solid.Checks.Reset"),
+		TEXT("Clears the solid_check/solid_cassume site counters."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			Reset();
+		}));
+
+} // namespace Solid::CheckProfiler::Private
+
+Solid::CheckProfiler::FCheckSite::FCheckSite(const ANSICHAR* InExpression, const ANSICHAR* InFile, const int32 InLine)
+	: Expression(InExpression)
+	, File(InFile)
+	, Line(InLine)
+{
+	Next = Private::SiteListHead.load(std::memory_order_relaxed);
+
+	while (!Private::SiteListHead.compare_exchange_weak(Next, this, std::memory_order_release, std::memory_order_relaxed))
+	{
+	}
+}
+
+void Solid::CheckProfiler::Dump(const int32 NumSites)
+{
+	TArray<const FCheckSite*> Sites;
+
+	for (const FCheckSite* Site = Private::SiteListHead.load(std::memory_order_acquire); Site; Site = Site->Next)
+	{
+		if (Site->Count.load(std::memory_order_relaxed) > 0)
+		{
+			Sites.Add(Site);
+		}
+	}
+
+	Sites.Sort([](const FCheckSite& A, const FCheckSite& B)
+	{
+#if SOLID_PROFILE_CHECK_CYCLES
+		return A.Cycles.load(std::memory_order_relaxed) > B.Cycles.load(std::memory_order_relaxed);
+#else // SOLID_PROFILE_CHECK_CYCLES
+		return A.Count.load(std::memory_order_relaxed) > B.Count.load(std::memory_order_relaxed);
+#endif // SOLID_PROFILE_CHECK_CYCLES
+	});
+
+	UE_LOGFMT(LogSolidMacros, Display, "Check sites: top {Num} of {Total}", FMath::Min(NumSites, Sites.Num()), Sites.Num());
+
+	for (int32 Index = 0; Index < FMath::Min(NumSites, Sites.Num()); ++Index)
+	{
+		const FCheckSite* Site = Sites[Index];
+
+		const uint64 Count = Site->Count.load(std::memory_order_relaxed);
+
+#if SOLID_PROFILE_CHECK_CYCLES
+		const double Milliseconds = FPlatformTime::ToMilliseconds64(Site->Cycles.load(std::memory_order_relaxed));
+
+		UE_LOGFMT(LogSolidMacros, Display, "  {File}({Line}): '{Expression}' evaluated {Count} times, {Milliseconds} ms total, {Nanoseconds} ns each",
+			ANSI_TO_TCHAR(Site->File), Site->Line, ANSI_TO_TCHAR(Site->Expression), Count, Milliseconds,
+			Milliseconds * 1000000.0 / static_cast<double>(Count));
+#else // SOLID_PROFILE_CHECK_CYCLES
+		UE_LOGFMT(LogSolidMacros, Display, "  {File}({Line}): '{Expression}' evaluated {Count} times",
+			ANSI_TO_TCHAR(Site->File), Site->Line, ANSI_TO_TCHAR(Site->Expression), Count);
+#endif // SOLID_PROFILE_CHECK_CYCLES
+	}
+}
+
+void Solid::CheckProfiler::Reset()
+{
+	for (FCheckSite* Site = Private::SiteListHead.load(std::memory_order_acquire); Site; Site = Site->Next)
+	{
+		Site->Count.store(0, std::memory_order_relaxed);
+		Site->Cycles.store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,239 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Diagnostics/SolidSampledCheck.h"
+
+#include <atomic>
+
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Logging/StructuredLog.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+#include "SolidMacros.h"
+
+CSV_DEFINE_CATEGORY(SolidSampledChecks, true);
+
+namespace Solid::SampledCheck::Private
+{
+	static constexpr uint32 FailureBufferCapacity = 1024;
+	static_assert(FMath::IsPowerOfTwo(FailureBufferCapacity), "FailureBufferCapacity must be a power of two.");
+
+	/**
+	 * Bounded multi-producer ring buffer, each slot carries a sequence number
+	 * telling producers and the consumer whose turn it is.
+	 */
+	struct FFailureRingBuffer
+	{
+		struct FSlot
+		{
+			std::atomic<uint64> Sequence { 0 };
+			FSampledCheckFailure Failure;
+		}; // struct FSlot
+
+		FFailureRingBuffer()
+		{
+			for (uint32 Index = 0; Index < FailureBufferCapacity; ++Index)
+			{
+				Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+			}
+		}
+
+		bool TryPush(const FSampledCheckFailure& Failure)
+		{
+			uint64 Position = Head.load(std::memory_order_relaxed);
+
+			for (;;)
+			{
+				FSlot& Slot = Slots[Position & (FailureBufferCapacity - 1)];
+				const uint64 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+				const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+
+				if (Difference == 0)
+				{
+					if (Head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+					{
+						Slot.Failure = Failure;
+						Slot.Sequence.store(Position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (Difference < 0)
+				{
+					// full, the consumer has not caught up with this lap yet
+					return false;
+				}
+				else
+				{
+					Position = Head.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// Single consumer
+		bool TryPop(FSampledCheckFailure& OutFailure)
+		{
+			const uint64 Position = Tail.load(std::memory_order_relaxed);
+
+			FSlot& Slot = Slots[Position & (FailureBufferCapacity - 1)];
+
+			if (Slot.Sequence.load(std::memory_order_acquire) != Position + 1)
+			{
+				return false;
+			}
+
+			OutFailure = Slot.Failure;
+			Slot.Sequence.store(Position + FailureBufferCapacity, std::memory_order_release);
+			Tail.store(Position + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		FSlot Slots[FailureBufferCapacity];
+
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Head { 0 };
+		alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> Tail { 0 };
+	}; // struct FFailureRingBuffer
+
+	static FFailureRingBuffer& GetFailureBuffer()
+	{
+		static FFailureRingBuffer Buffer;
+		return Buffer;
+	}
+
+	static std::atomic<uint64> NumReported { 0 };
+	static std::atomic<uint64> NumDropped { 0 };
+
+	// Flush is reachable from the ticker and the console, the ring buffer only supports one consumer
+	static FCriticalSection FlushCriticalSection;
+
+	static float FlushIntervalSeconds = 1.0f;
+	static FAutoConsoleVariableRef CVarFlushInterval(
+		TEXT("Solid.SampledChecks.FlushInterval"),
+		FlushIntervalSeconds,
+		TEXT("Seconds between flushes of failed solid_check_sampled checks to the log and CSV profiler, 0 disables the periodic flush."));
+
+	static FAutoConsoleCommand FlushCommand(
+		TEXT("Solid.SampledChecks.Flush"),
+		TEXT("Flushes failed solid_check_sampled checks to the log and CSV profiler."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			Flush();
+		}));
+
+	static FTSTicker::FDelegateHandle FlushTickerHandle;
+	static float TimeSinceFlush = 0.0f;
+
+	uint32 SeedThreadState()
+	{
+		static std::atomic<uint32> SeedCounter { 0x9E3779B9u };
+
+		// never zero, xorshift would stay at zero forever
+		const uint32 Seed = SeedCounter.fetch_add(0x9E3779B9u, std::memory_order_relaxed) ^ FPlatformTLS::GetCurrentThreadId();
+		return Seed != 0 ? Seed : 0x6C8E9CF5u;
+	}
+
+	void Startup()
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](const float DeltaTime)
+		{
+			if (FlushIntervalSeconds <= 0.0f)
+			{
+				return true;
+			}
+
+			TimeSinceFlush += DeltaTime;
+
+			if (TimeSinceFlush >= FlushIntervalSeconds)
+			{
+				TimeSinceFlush = 0.0f;
+				Flush();
+			}
+
+			return true;
+		}));
+	}
+
+	void Shutdown()
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+
+		Flush();
+	}
+
+} // namespace Solid::SampledCheck::Private
+
+void Solid::SampledCheck::ReportFailure(const ANSICHAR* Expression, const ANSICHAR* File, const int32 Line)
+{
+	Private::NumReported.fetch_add(1, std::memory_order_relaxed);
+
+	FSampledCheckFailure Failure;
+	Failure.Expression = Expression;
+	Failure.File = File;
+	Failure.Line = Line;
+	Failure.ThreadId = FPlatformTLS::GetCurrentThreadId();
+	Failure.Cycles = FPlatformTime::Cycles64();
+
+	if UNLIKELY_IF(!Private::GetFailureBuffer().TryPush(Failure))
+	{
+		Private::NumDropped.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+int32 Solid::SampledCheck::Flush()
+{
+	FScopeLock Lock(&Private::FlushCriticalSection);
+
+	struct FSiteSummary
+	{
+		const ANSICHAR* Expression = nullptr;
+		const ANSICHAR* File = nullptr;
+		int32 Line = 0;
+		int32 Count = 0;
+		uint32 LastThreadId = 0;
+	}; // struct FSiteSummary
+
+	// a failing site usually fails many times per interval, report it once with a count
+	TMap<TPair<const ANSICHAR*, int32>, FSiteSummary> Sites;
+
+	int32 NumDrained = 0;
+
+	FSampledCheckFailure Failure;
+
+	while (Private::GetFailureBuffer().TryPop(Failure))
+	{
+		FSiteSummary& Summary = Sites.FindOrAdd(MakeTuple(Failure.File, Failure.Line));
+		Summary.Expression = Failure.Expression;
+		Summary.File = Failure.File;
+		Summary.Line = Failure.Line;
+		Summary.LastThreadId = Failure.ThreadId;
+		++Summary.Count;
+
+		++NumDrained;
+	}
+
+	for (const TPair<TPair<const ANSICHAR*, int32>, FSiteSummary>& Site : Sites)
+	{
+		const FSiteSummary& Summary = Site.Value;
+
+		UE_LOGFMT(LogSolidMacros, Warning, "solid_check_sampled failed {Count} time(s): '{Expression}' at {File}({Line}), last on thread {ThreadId}",
+			Summary.Count, ANSI_TO_TCHAR(Summary.Expression), ANSI_TO_TCHAR(Summary.File), Summary.Line, Summary.LastThreadId);
+
+		CSV_EVENT(SolidSampledChecks, TEXT("%hs(%d): %hs x%d"), Summary.File, Summary.Line, Summary.Expression, Summary.Count);
+	}
+
+	CSV_CUSTOM_STAT(SolidSampledChecks, Failures, NumDrained, ECsvCustomStatOp::Accumulate);
+
+	return NumDrained;
+}
+
+uint64 Solid::SampledCheck::GetNumReported()
+{
+	return Private::NumReported.load(std::memory_order_relaxed);
+}
+
+uint64 Solid::SampledCheck::GetNumDropped()
+{
+	return Private::NumDropped.load(std::memory_order_relaxed);
+}
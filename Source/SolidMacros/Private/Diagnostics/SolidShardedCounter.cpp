@@ -0,0 +1,140 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Diagnostics/SolidShardedCounter.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/CoreDelegates.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+#include "SolidMacros.h"
+
+CSV_DEFINE_CATEGORY(SolidCounters, true);
+
+namespace Solid::ShardedCounter::Private
+{
+	struct FRegistry
+	{
+		FCriticalSection CriticalSection;
+		TArray<FShardedCounterBase*> Counters;
+	}; // struct FRegistry
+
+	static FRegistry& GetRegistry()
+	{
+		static FRegistry Registry;
+		return Registry;
+	}
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("Solid.Counters.Dump"),
+		TEXT("Logs every registered sharded counter. Arguments: [NameFilter]."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			Dump(Args.IsValidIndex(0) ? Args[0] : FString());
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("Solid.Counters.Reset"),
+		TEXT("Resets every registered sharded counter."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			ResetAll();
+		}));
+
+	static FDelegateHandle EndFrameHandle;
+
+	int32 AssignThreadShard()
+	{
+		static std::atomic<int32> NextShard { 0 };
+
+		return NextShard.fetch_add(1, std::memory_order_relaxed) & (NumShards - 1);
+	}
+
+	void Startup()
+	{
+#if CSV_PROFILER
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddLambda([]()
+		{
+			if (!FCsvProfiler::Get()->IsCapturing())
+			{
+				return;
+			}
+
+			FRegistry& Registry = GetRegistry();
+
+			FScopeLock Lock(&Registry.CriticalSection);
+
+			for (const FShardedCounterBase* Counter : Registry.Counters)
+			{
+				FCsvProfiler::RecordCustomStat(Counter->GetName(), CSV_CATEGORY_INDEX(SolidCounters),
+					Counter->GetCsvValue(), ECsvCustomStatOp::Set);
+			}
+		});
+#endif // CSV_PROFILER
+	}
+
+	void Shutdown()
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		EndFrameHandle.Reset();
+	}
+
+} // namespace Solid::ShardedCounter::Private
+
+Solid::FShardedCounterBase::FShardedCounterBase(const TCHAR* InName)
+	: Name(InName)
+{
+	ShardedCounter::Private::FRegistry& Registry = ShardedCounter::Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+	Registry.Counters.Add(this);
+}
+
+Solid::FShardedCounterBase::~FShardedCounterBase()
+{
+	ShardedCounter::Private::FRegistry& Registry = ShardedCounter::Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+	Registry.Counters.RemoveSingleSwap(this);
+}
+
+void Solid::ShardedCounter::Dump(const FString& Filter)
+{
+	Private::FRegistry& Registry = Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+
+	TArray<const FShardedCounterBase*> Counters(Registry.Counters);
+
+	Counters.Sort([](const FShardedCounterBase& A, const FShardedCounterBase& B)
+	{
+		return A.GetName().LexicalLess(B.GetName());
+	});
+
+	TStringBuilder<512> Builder;
+
+	for (const FShardedCounterBase* Counter : Counters)
+	{
+		if (!Filter.IsEmpty() && !Counter->GetName().ToString().Contains(Filter))
+		{
+			continue;
+		}
+
+		Builder.Reset();
+		Counter->Describe(Builder);
+
+		UE_LOGFMT(LogSolidMacros, Display, "{Name}: {Value}", Counter->GetName(), Builder.ToView());
+	}
+}
+
+void Solid::ShardedCounter::ResetAll()
+{
+	Private::FRegistry& Registry = Private::GetRegistry();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+
+	for (FShardedCounterBase* Counter : Registry.Counters)
+	{
+		Counter->Reset();
+	}
+}
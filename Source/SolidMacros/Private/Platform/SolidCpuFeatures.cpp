@@ -0,0 +1,190 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Platform/SolidCpuFeatures.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+
+#if IS_MSVC
+#include <intrin.h>
+#else // IS_MSVC
+#include <cpuid.h>
+#endif // IS_MSVC
+
+#endif // PLATFORM_CPU_X86_FAMILY
+
+namespace Solid::Private
+{
+#if PLATFORM_CPU_X86_FAMILY
+
+	struct FCpuIdRegisters
+	{
+		uint32 Eax = 0;
+		uint32 Ebx = 0;
+		uint32 Ecx = 0;
+		uint32 Edx = 0;
+	}; // struct FCpuIdRegisters
+
+	static FCpuIdRegisters CpuId(const uint32 Leaf, const uint32 SubLeaf = 0)
+	{
+		FCpuIdRegisters Registers;
+
+#if IS_MSVC
+		int32 Values[4];
+		__cpuidex(Values, static_cast<int32>(Leaf), static_cast<int32>(SubLeaf));
+
+		Registers.Eax = static_cast<uint32>(Values[0]);
+		Registers.Ebx = static_cast<uint32>(Values[1]);
+		Registers.Ecx = static_cast<uint32>(Values[2]);
+		Registers.Edx = static_cast<uint32>(Values[3]);
+#else // IS_MSVC
+		__cpuid_count(Leaf, SubLeaf, Registers.Eax, Registers.Ebx, Registers.Ecx, Registers.Edx);
+#endif // IS_MSVC
+
+		return Registers;
+	}
+
+	// Register state the OS saves on context switches, only valid when OSXSAVE is set
+	static uint64 GetExtendedControlRegister()
+	{
+#if IS_MSVC
+		return _xgetbv(0);
+#else // IS_MSVC
+		// inline asm so the translation unit does not need -mxsave
+		uint32 Low = 0;
+		uint32 High = 0;
+		__asm__ volatile ("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+		return (static_cast<uint64>(High) << 32) | Low;
+#endif // IS_MSVC
+	}
+
+	static bool IsBitSet(const uint32 Value, const uint32 Bit)
+	{
+		return (Value & (1u << Bit)) != 0;
+	}
+
+#endif // PLATFORM_CPU_X86_FAMILY
+
+} // namespace Solid::Private
+
+const Solid::FCpuFeatures& Solid::FCpuFeatures::Get()
+{
+	static const FCpuFeatures CpuFeatures = Detect();
+	return CpuFeatures;
+}
+
+Solid::FCpuFeatures Solid::FCpuFeatures::Detect()
+{
+	FCpuFeatures CpuFeatures;
+
+#if PLATFORM_CPU_X86_FAMILY
+	const uint32 MaxLeaf = Private::CpuId(0).Eax;
+
+	if (MaxLeaf < 1)
+	{
+		return CpuFeatures;
+	}
+
+	const Private::FCpuIdRegisters Leaf1 = Private::CpuId(1);
+
+	if (Private::IsBitSet(Leaf1.Ecx, 20))
+	{
+		CpuFeatures.Features |= ECpuFeature::SSE42;
+	}
+
+	if (Private::IsBitSet(Leaf1.Ecx, 23))
+	{
+		CpuFeatures.Features |= ECpuFeature::POPCNT;
+	}
+
+	// XCR0 bits 1 and 2 are the SSE and AVX register state, 5 to 7 the AVX-512 opmask and upper registers
+	const bool bOsSavesRegisters = Private::IsBitSet(Leaf1.Ecx, 27);
+	const uint64 ExtendedControl = bOsSavesRegisters ? Private::GetExtendedControlRegister() : 0;
+	const bool bOsSavesAvx = (ExtendedControl & 0x6) == 0x6;
+	const bool bOsSavesAvx512 = bOsSavesAvx && (ExtendedControl & 0xE0) == 0xE0;
+
+	if (bOsSavesAvx && Private::IsBitSet(Leaf1.Ecx, 28))
+	{
+		CpuFeatures.Features |= ECpuFeature::AVX;
+
+		if (Private::IsBitSet(Leaf1.Ecx, 12))
+		{
+			CpuFeatures.Features |= ECpuFeature::FMA;
+		}
+	}
+
+	if (MaxLeaf >= 7)
+	{
+		const Private::FCpuIdRegisters Leaf7 = Private::CpuId(7, 0);
+
+		if (EnumHasAllFlags(CpuFeatures.Features, ECpuFeature::AVX) && Private::IsBitSet(Leaf7.Ebx, 5))
+		{
+			CpuFeatures.Features |= ECpuFeature::AVX2;
+		}
+
+		if (bOsSavesAvx512 && Private::IsBitSet(Leaf7.Ebx, 16))
+		{
+			CpuFeatures.Features |= ECpuFeature::AVX512F;
+		}
+
+		if (Private::IsBitSet(Leaf7.Ebx, 3))
+		{
+			CpuFeatures.Features |= ECpuFeature::BMI1;
+		}
+
+		if (Private::IsBitSet(Leaf7.Ebx, 8))
+		{
+			CpuFeatures.Features |= ECpuFeature::BMI2;
+		}
+	}
+
+	if (Private::CpuId(0x80000000).Eax >= 0x80000001)
+	{
+		// ABM on AMD, reported in the same bit on Intel
+		if (Private::IsBitSet(Private::CpuId(0x80000001).Ecx, 5))
+		{
+			CpuFeatures.Features |= ECpuFeature::LZCNT;
+		}
+	}
+#endif // PLATFORM_CPU_X86_FAMILY
+
+	return CpuFeatures;
+}
+
+FString Solid::FCpuFeatures::ToString() const
+{
+	struct FFeatureName
+	{
+		ECpuFeature Feature;
+		const TCHAR* Name;
+	}; // struct FFeatureName
+
+	static constexpr FFeatureName Names[] =
+	{
+		{ ECpuFeature::SSE42, TEXT("SSE4.2") },
+		{ ECpuFeature::POPCNT, TEXT("POPCNT") },
+		{ ECpuFeature::AVX, TEXT("AVX") },
+		{ ECpuFeature::AVX2, TEXT("AVX2") },
+		{ ECpuFeature::FMA, TEXT("FMA") },
+		{ ECpuFeature::AVX512F, TEXT("AVX-512F") },
+		{ ECpuFeature::BMI1, TEXT("BMI1") },
+		{ ECpuFeature::BMI2, TEXT("BMI2") },
+		{ ECpuFeature::LZCNT, TEXT("LZCNT") },
+	};
+
+	TStringBuilder<128> Builder;
+
+	for (const FFeatureName& Name : Names)
+	{
+		if (EnumHasAllFlags(Features, Name.Feature))
+		{
+			if (Builder.Len() > 0)
+			{
+				Builder << TEXT(' ');
+			}
+
+			Builder << Name.Name;
+		}
+	}
+
+	return Builder.Len() > 0 ? FString(Builder.ToView()) : FString(TEXT("None"));
+}
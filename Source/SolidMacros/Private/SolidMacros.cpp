@@ -2,14 +2,49 @@
 
 #include "SolidMacros.h"
 
+#include "SolidMacros/Macros.h"
+#include "Diagnostics/SolidSampledCheck.h"
+#include "Diagnostics/SolidShardedCounter.h"
+#include "Logging/StructuredLog.h"
+#include "Platform/SolidCpuFeatures.h"
+#include "Types/SolidCppStructOps.h"
+#include "Types/SolidStructPoolAllocator.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY(LogSolidMacros);
+
+#if SOLID_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(SolidChannel);
+#endif // SOLID_TRACE_ENABLED
+
 #define LOCTEXT_NAMESPACE "FSolidMacrosModule"
 
 void FSolidMacrosModule::StartupModule()
 {
+	// probe once up front so no kernel dispatch pays for cpuid on a hot path
+	UE_LOGFMT(LogSolidMacros, Log, "CPU features: {Features}", Solid::FCpuFeatures::Get().ToString());
+
+	Solid::SampledCheck::Private::Startup();
+	Solid::ShardedCounter::Private::Startup();
+	Solid::StructPool::Private::Startup();
+
+	// structs of modules loaded after this one are picked up once their UObjects are registered
+	CompiledInUObjectsRegisteredHandle = FCoreUObjectDelegates::CompiledInUObjectsRegisteredDelegate.AddLambda([](auto&&...)
+	{
+		FSolidMoveableStructRegistry::ProcessPendingRegistrations();
+	});
+
+	FSolidMoveableStructRegistry::ProcessPendingRegistrations();
 }
 
 void FSolidMacrosModule::ShutdownModule()
 {
+	FCoreUObjectDelegates::CompiledInUObjectsRegisteredDelegate.Remove(CompiledInUObjectsRegisteredHandle);
+	CompiledInUObjectsRegisteredHandle.Reset();
+
+	Solid::StructPool::Private::Shutdown();
+	Solid::ShardedCounter::Private::Shutdown();
+	Solid::SampledCheck::Private::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
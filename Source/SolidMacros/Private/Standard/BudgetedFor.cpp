@@ -0,0 +1,133 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Standard/BudgetedFor.h"
+
+namespace Solid::Private
+{
+	// Weight of the newest tick in the per-iteration cost average
+	static constexpr double BudgetedForCostSmoothing = 0.25;
+
+	// Aim for this many time checks per budget once the cost per iteration is known
+	static constexpr int64 BudgetedForTimeChecksPerBudget = 16;
+
+	static constexpr int64 BudgetedForMaxIterationsPerCheck = 4096;
+
+} // namespace Solid::Private
+
+double Solid::FBudgetedForStats::GetAverageMicrosecondsPerIteration() const
+{
+	return AverageCyclesPerIteration * FPlatformTime::GetSecondsPerCycle64() * 1000000.0;
+}
+
+double Solid::FBudgetedForStats::GetLastTickMicroseconds() const
+{
+	return FBudgetedFor::CyclesToMicroseconds(LastTickCycles);
+}
+
+double Solid::FBudgetedForStats::GetMaxTickMicroseconds() const
+{
+	return FBudgetedFor::CyclesToMicroseconds(MaxTickCycles);
+}
+
+Solid::FBudgetedFor::FBudgetedFor(const int64 InMin, const int64 InMax)
+{
+	Reset(InMin, InMax);
+}
+
+void Solid::FBudgetedFor::Reset(const int64 InMin, const int64 InMax)
+{
+	Min = InMin;
+	Max = FMath::Max(InMin, InMax);
+	Cursor = InMin;
+}
+
+void Solid::FBudgetedFor::ResetStats()
+{
+	Stats = FBudgetedForStats();
+}
+
+float Solid::FBudgetedFor::GetProgress() const
+{
+	const int64 Count = Max - Min;
+
+	if (Count <= 0)
+	{
+		return 1.0f;
+	}
+
+	return static_cast<float>(static_cast<double>(Cursor - Min) / static_cast<double>(Count));
+}
+
+int64 Solid::FBudgetedFor::EstimateIterationsForBudget(const double BudgetMicroseconds) const
+{
+	if (Stats.AverageCyclesPerIteration <= 0.0)
+	{
+		return 1;
+	}
+
+	const double Iterations = static_cast<double>(MicrosecondsToCycles(BudgetMicroseconds)) / Stats.AverageCyclesPerIteration;
+	return FMath::Max<int64>(static_cast<int64>(Iterations), 1);
+}
+
+double Solid::FBudgetedFor::EstimateRemainingMicroseconds() const
+{
+	return static_cast<double>(GetRemaining()) * Stats.GetAverageMicrosecondsPerIteration();
+}
+
+double Solid::FBudgetedFor::GetAdaptiveBudgetMicroseconds(const int32 NumTicks,
+	const double MinMicroseconds, const double MaxMicroseconds) const
+{
+	if (Stats.AverageCyclesPerIteration <= 0.0)
+	{
+		return MaxMicroseconds;
+	}
+
+	const double Budget = EstimateRemainingMicroseconds() / FMath::Max(NumTicks, 1);
+	return FMath::Clamp(Budget, MinMicroseconds, MaxMicroseconds);
+}
+
+uint64 Solid::FBudgetedFor::MicrosecondsToCycles(const double Microseconds)
+{
+	return static_cast<uint64>(FMath::Max(Microseconds, 0.0) / (FPlatformTime::GetSecondsPerCycle64() * 1000000.0));
+}
+
+double Solid::FBudgetedFor::CyclesToMicroseconds(const uint64 Cycles)
+{
+	return FPlatformTime::ToSeconds64(Cycles) * 1000000.0;
+}
+
+int64 Solid::FBudgetedFor::GetIterationsPerTimeCheck(const uint64 BudgetCycles) const
+{
+	// unknown cost, check after every iteration until the first tick has measured it
+	if (Stats.AverageCyclesPerIteration <= 0.0)
+	{
+		return 1;
+	}
+
+	const double CyclesPerCheck = static_cast<double>(BudgetCycles) / Private::BudgetedForTimeChecksPerBudget;
+	const int64 Iterations = static_cast<int64>(CyclesPerCheck / Stats.AverageCyclesPerIteration);
+
+	return FMath::Clamp<int64>(Iterations, 1, Private::BudgetedForMaxIterationsPerCheck);
+}
+
+void Solid::FBudgetedFor::RecordTick(const uint64 Iterations, const uint64 Cycles)
+{
+	Stats.TotalIterations += Iterations;
+	Stats.TotalCycles += Cycles;
+	++Stats.NumTicks;
+
+	Stats.LastTickIterations = Iterations;
+	Stats.LastTickCycles = Cycles;
+	Stats.MaxTickCycles = FMath::Max(Stats.MaxTickCycles, Cycles);
+
+	if (Iterations == 0)
+	{
+		return;
+	}
+
+	const double TickCyclesPerIteration = static_cast<double>(Cycles) / static_cast<double>(Iterations);
+
+	Stats.AverageCyclesPerIteration = Stats.AverageCyclesPerIteration <= 0.0
+		? TickCyclesPerIteration
+		: FMath::Lerp(Stats.AverageCyclesPerIteration, TickCyclesPerIteration, Private::BudgetedForCostSmoothing);
+}
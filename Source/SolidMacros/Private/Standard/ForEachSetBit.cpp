@@ -0,0 +1,62 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Standard/ForEachSetBit.h"
+
+#include "Platform/SolidCpuFeatures.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif // PLATFORM_CPU_X86_FAMILY
+
+namespace Solid::Private
+{
+	static constexpr int32 BitScanBlockSize = 32;
+
+	static int32 FindFirstNonZeroBlockScalar(const uint8* Data, const int32 NumBlocks)
+	{
+		for (int32 Block = 0; Block < NumBlocks; ++Block)
+		{
+			uint64 Lanes[BitScanBlockSize / sizeof(uint64)];
+			FMemory::Memcpy(Lanes, Data + Block * BitScanBlockSize, BitScanBlockSize);
+
+			if ((Lanes[0] | Lanes[1] | Lanes[2] | Lanes[3]) != 0)
+			{
+				return Block;
+			}
+		}
+
+		return NumBlocks;
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+
+	SOLID_TARGET("avx,avx2")
+	static int32 FindFirstNonZeroBlockAVX2(const uint8* Data, const int32 NumBlocks)
+	{
+		for (int32 Block = 0; Block < NumBlocks; ++Block)
+		{
+			const __m256i Vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Block * BitScanBlockSize));
+
+			if (!_mm256_testz_si256(Vector, Vector))
+			{
+				return Block;
+			}
+		}
+
+		return NumBlocks;
+	}
+
+#endif // PLATFORM_CPU_X86_FAMILY
+
+	static const TCpuDispatch<int32(const uint8*, int32)> FindFirstNonZeroBlockDispatch {
+#if PLATFORM_CPU_X86_FAMILY
+		{ ECpuFeature::AVX2, &FindFirstNonZeroBlockAVX2 },
+#endif // PLATFORM_CPU_X86_FAMILY
+		{ ECpuFeature::None, &FindFirstNonZeroBlockScalar } };
+
+} // namespace Solid::Private
+
+int32 Solid::Private::FindFirstNonZeroBlock(const uint8* Data, const int32 NumBlocks)
+{
+	return FindFirstNonZeroBlockDispatch(Data, NumBlocks);
+}
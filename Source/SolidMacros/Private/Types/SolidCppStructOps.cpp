@@ -2,32 +2,157 @@
 
 #include "Types/SolidCppStructOps.h"
 
+#include "Logging/StructuredLog.h"
+#include "UObject/UObjectGlobals.h"
+
+std::atomic<FSolidStructOpsRegistration*> FSolidStructOpsRegistration::PendingHead { nullptr };
+
+FSolidStructOpsRegistration::FSolidStructOpsRegistration(const FRegisterFunc InRegisterFunction)
+	: RegisterFunction(InRegisterFunction)
+{
+	Next = PendingHead.load(std::memory_order_relaxed);
+
+	while (!PendingHead.compare_exchange_weak(Next, this, std::memory_order_release, std::memory_order_relaxed))
+	{
+	}
+}
+
 FSolidMoveableStructRegistry& FSolidMoveableStructRegistry::Get()
 {
 	static FSolidMoveableStructRegistry Instance;
 	return Instance;
 }
 
+void FSolidMoveableStructRegistry::ProcessPendingRegistrations()
+{
+	if (!UObjectInitialized())
+	{
+		return;
+	}
+
+	FSolidMoveableStructRegistry& Registry = Get();
+
+	FScopeLock Lock(&Registry.CriticalSection);
+
+	// the lock is recursive, a lookup made by a register function must not start a second pass
+	static bool bIsProcessing = false;
+
+	if (bIsProcessing)
+	{
+		return;
+	}
+
+	TGuardValue<bool> ProcessingGuard(bIsProcessing, true);
+
+	// left on the list until registered, a concurrent FindHandle keeps seeing HasPending() and waits on the lock
+	FSolidStructOpsRegistration* const Registration = FSolidStructOpsRegistration::PendingHead.load(std::memory_order_acquire);
+
+	if (Registration == nullptr)
+	{
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	int32 NumRegistrations = 0;
+
+	for (const FSolidStructOpsRegistration* Record = Registration; Record; Record = Record->Next)
+	{
+		Record->RegisterFunction(Registry);
+		++NumRegistrations;
+	}
+
+	// records pushed meanwhile sit in front of Registration, detach the registered tail from them
+	FSolidStructOpsRegistration* Expected = Registration;
+
+	if (!FSolidStructOpsRegistration::PendingHead.compare_exchange_strong(Expected, nullptr, std::memory_order_release,
+		std::memory_order_acquire))
+	{
+		FSolidStructOpsRegistration* Previous = Expected;
+
+		while (Previous->Next != Registration)
+		{
+			Previous = Previous->Next;
+		}
+
+		Previous->Next = nullptr;
+	}
+
+	UE_LOGFMT(LogSolidMacros, Log, "Registered {Num} moveable structs in {Milliseconds} ms",
+		NumRegistrations, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+}
+
 bool FSolidMoveableStructRegistry::IsStructMovable(const TSolidNotNull<const UScriptStruct*> InStruct) const
 {
-	return MoveableStructs.Contains(InStruct);
+	return FindHandle(InStruct).IsValid();
 }
 
 bool FSolidMoveableStructRegistry::IsStructMoveConstructible(const TSolidNotNull<const UScriptStruct*> InStruct) const
 {
-	return IsStructMovable(InStruct) && GetStructTypeHookInfo(InStruct).MoveConstructor != nullptr;
+	const FStructTypeHookInfo* TypeHookInfo = FindStructTypeHookInfo(InStruct);
+	return TypeHookInfo && TypeHookInfo->MoveConstructor != nullptr;
 }
 
 bool FSolidMoveableStructRegistry::IsStructMoveAssignable(const TSolidNotNull<const UScriptStruct*> InStruct) const
 {
-	return IsStructMovable(InStruct) && GetStructTypeHookInfo(InStruct).MoveAssignment != nullptr;
+	const FStructTypeHookInfo* TypeHookInfo = FindStructTypeHookInfo(InStruct);
+	return TypeHookInfo && TypeHookInfo->MoveAssignment != nullptr;
 }
 
 const FSolidMoveableStructRegistry::FStructTypeHookInfo& FSolidMoveableStructRegistry::GetStructTypeHookInfo(
 	const TSolidNotNull<const UScriptStruct*> InStruct) const
 {
-	solid_checkf(IsStructMovable(InStruct), TEXT("InStruct is not registered as moveable!"));
-	return MoveableStructs.FindChecked(InStruct);
+	const FStructTypeHookInfo* TypeHookInfo = FindStructTypeHookInfo(InStruct);
+	solid_checkf(TypeHookInfo, TEXT("InStruct is not registered as moveable!"));
+	return *TypeHookInfo;
+}
+
+void FSolidMoveableStructRegistry::AddStructTypeHookInfo(const TSolidNotNull<const UScriptStruct*> InStruct,
+	FStructTypeHookInfo&& TypeHookInfo)
+{
+	TypeHookInfo.Struct = InStruct.Get();
+
+	FScopeLock Lock(&CriticalSection);
+
+	// registering twice takes a new slot, a reader may still be using the old hooks
+	const int32 SlotIndex = NumStructTypeHookInfos;
+	const int32 HookInfoChunkIndex = SlotIndex >> HookInfoChunkShift;
+
+	solid_checkf(HookInfoChunkIndex < MaxHookInfoChunks, TEXT("Too many moveable structs registered, raise MaxHookInfoChunks!"));
+
+	FStructTypeHookInfo* HookInfoChunk = HookInfoChunks[HookInfoChunkIndex].load(std::memory_order_relaxed);
+
+	if (HookInfoChunk == nullptr)
+	{
+		HookInfoChunk = new FStructTypeHookInfo[HookInfoChunkSize];
+		HookInfoChunks[HookInfoChunkIndex].store(HookInfoChunk, std::memory_order_release);
+	}
+
+	HookInfoChunk[SlotIndex & (HookInfoChunkSize - 1)] = MoveTemp(TypeHookInfo);
+	++NumStructTypeHookInfos;
+
+	const uint32 ObjectIndex = InStruct->GetUniqueID();
+	const uint32 SlotIndexChunkIndex = ObjectIndex >> SlotIndexChunkShift;
+
+	solid_checkf(SlotIndexChunkIndex < MaxSlotIndexChunks, TEXT("UObject index %u is past the struct ops lookup, raise MaxSlotIndexChunks!"),
+		ObjectIndex);
+
+	std::atomic<int32>* SlotIndexChunk = SlotIndexChunks[SlotIndexChunkIndex].load(std::memory_order_relaxed);
+
+	if (SlotIndexChunk == nullptr)
+	{
+		SlotIndexChunk = new std::atomic<int32>[SlotIndexChunkSize];
+
+		for (int32 Index = 0; Index < SlotIndexChunkSize; ++Index)
+		{
+			SlotIndexChunk[Index].store(INDEX_NONE, std::memory_order_relaxed);
+		}
+
+		SlotIndexChunks[SlotIndexChunkIndex].store(SlotIndexChunk, std::memory_order_release);
+	}
+
+	// release publishes the hook info written above
+	SlotIndexChunk[ObjectIndex & (SlotIndexChunkSize - 1)].store(SlotIndex, std::memory_order_release);
 }
 
 /*
@@ -0,0 +1,60 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Types/SolidCppStructOpsParallel.h"
+
+#include <numeric>
+
+#include "HAL/IConsoleManager.h"
+
+namespace Solid::StructOpsParallel::Private
+{
+	// Below this a single thread is already limited by memory bandwidth, tasks only add latency.
+	// Starting point only, Solid.Benchmarks.StructMoveParallel logs the crossover of the running machine.
+	static int32 ThresholdKiB = 512;
+	static FAutoConsoleVariableRef CVarThreshold(
+		TEXT("Solid.StructOps.ParallelMoveThreshold"),
+		ThresholdKiB,
+		TEXT("KiB a MoveConstructScriptStructParallel batch needs before it is split across workers."));
+
+	// Bytes each worker claims at once, large enough to amortize claiming a chunk
+	static int32 ChunkKiB = 64;
+	static FAutoConsoleVariableRef CVarChunk(
+		TEXT("Solid.StructOps.ParallelMoveChunk"),
+		ChunkKiB,
+		TEXT("KiB each worker claims at once in MoveConstructScriptStructParallel."));
+
+} // namespace Solid::StructOpsParallel::Private
+
+SIZE_T Solid::Private::GetParallelStructMoveThresholdBytes()
+{
+	return static_cast<SIZE_T>(FMath::Max(StructOpsParallel::Private::ThresholdKiB, 0)) * 1024;
+}
+
+void Solid::Private::MoveConstructScriptStructChunked(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+	void* Dest, void* Src, const uint32 Count, const FParallelForSettings& Settings)
+{
+	const SIZE_T Size = static_cast<SIZE_T>(TypeHookInfo.Size);
+	const SIZE_T ChunkBytes = static_cast<SIZE_T>(FMath::Max(StructOpsParallel::Private::ChunkKiB, 1)) * 1024;
+
+	// smallest element count whose byte size is a multiple of the cache line
+	const SIZE_T ElementsPerLinePeriod = SOLID_CACHE_LINE_SIZE / std::gcd(Size, static_cast<SIZE_T>(SOLID_CACHE_LINE_SIZE));
+	const SIZE_T ElementsPerChunk = FMath::Max(ElementsPerLinePeriod, (ChunkBytes / Size) / ElementsPerLinePeriod * ElementsPerLinePeriod);
+
+	const int64 NumChunks = static_cast<int64>((Count + ElementsPerChunk - 1) / ElementsPerChunk);
+
+	// the chunks are already coarse, let every one of them be claimed on its own
+	FParallelForSettings ChunkSettings = Settings;
+	ChunkSettings.SerialThreshold = 2;
+	ChunkSettings.MinChunkSize = 1;
+
+	uint8* DestBytes = static_cast<uint8*>(Dest);
+	uint8* SrcBytes = static_cast<uint8*>(Src);
+
+	ParallelFor(NumChunks, [&TypeHookInfo, DestBytes, SrcBytes, Size, ElementsPerChunk, Count](const int64 Chunk)
+	{
+		const SIZE_T Begin = static_cast<SIZE_T>(Chunk) * ElementsPerChunk;
+		const SIZE_T Num = FMath::Min(ElementsPerChunk, static_cast<SIZE_T>(Count) - Begin);
+
+		MoveConstructScriptStruct(TypeHookInfo, DestBytes + Begin * Size, SrcBytes + Begin * Size, static_cast<uint32>(Num));
+	}, ChunkSettings);
+}
@@ -0,0 +1,225 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Types/SolidStructArray.h"
+
+#include "UObject/UObjectGlobals.h"
+
+FSolidStructArray::FSolidStructArray(const TSolidNotNull<const UScriptStruct*> InStruct)
+	: Struct(InStruct)
+	, Handle(FSolidMoveableStructRegistry::Get().FindHandle(InStruct))
+{
+	solid_checkf(Handle.IsValid(), TEXT("FSolidStructArray needs a struct registered with DEFINE_SOLID_MOVEABLE_CPP_STRUCT, %s is not"),
+		*InStruct->GetName());
+
+	Alignment = FMath::Max(InStruct->GetMinAlignment(), 1);
+	Stride = Align(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle).Size, Alignment);
+}
+
+FSolidStructArray::FSolidStructArray(const FSolidStructArray& Other)
+	: Struct(Other.Struct)
+	, Handle(Other.Handle)
+	, Stride(Other.Stride)
+	, Alignment(Other.Alignment)
+{
+	if (Other.ArrayNum > 0)
+	{
+		ResizeAllocation(Other.ArrayNum);
+		Solid::CopyConstructScriptStruct(Handle, Data, Other.Data, static_cast<uint32>(Other.ArrayNum));
+		ArrayNum = Other.ArrayNum;
+	}
+}
+
+FSolidStructArray::FSolidStructArray(FSolidStructArray&& Other) noexcept
+	: Struct(Other.Struct)
+	, Handle(Other.Handle)
+	, Data(Other.Data)
+	, ArrayNum(Other.ArrayNum)
+	, ArrayMax(Other.ArrayMax)
+	, Stride(Other.Stride)
+	, Alignment(Other.Alignment)
+{
+	Other.Data = nullptr;
+	Other.ArrayNum = 0;
+	Other.ArrayMax = 0;
+}
+
+FSolidStructArray& FSolidStructArray::operator=(const FSolidStructArray& Other)
+{
+	if (this != &Other)
+	{
+		FSolidStructArray Copy(Other);
+		*this = MoveTemp(Copy);
+	}
+
+	return *this;
+}
+
+FSolidStructArray& FSolidStructArray::operator=(FSolidStructArray&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Empty();
+
+		Struct = Other.Struct;
+		Handle = Other.Handle;
+		Data = Other.Data;
+		ArrayNum = Other.ArrayNum;
+		ArrayMax = Other.ArrayMax;
+		Stride = Other.Stride;
+		Alignment = Other.Alignment;
+
+		Other.Data = nullptr;
+		Other.ArrayNum = 0;
+		Other.ArrayMax = 0;
+	}
+
+	return *this;
+}
+
+FSolidStructArray::~FSolidStructArray()
+{
+	Empty();
+}
+
+void FSolidStructArray::Reserve(const int32 Number)
+{
+	if (Number > ArrayMax)
+	{
+		ResizeAllocation(Number);
+	}
+}
+
+int32 FSolidStructArray::AddDefaulted(const int32 Count)
+{
+	const int32 Index = AddUninitialized(Count);
+	Solid::DefaultConstructScriptStruct(Handle, Data + static_cast<SIZE_T>(Index) * Stride, static_cast<uint32>(Count));
+
+	return Index;
+}
+
+int32 FSolidStructArray::Add(const FConstStructView Value)
+{
+	solid_checkf(Value.GetScriptStruct() == Struct, TEXT("FSolidStructArray::Add with the wrong struct type!"));
+
+	// Value may live in this array, copy it before growing moves it
+	const uint8* Source = Value.GetMemory();
+	const bool bSourceIsElement = Source >= Data && Source < Data + static_cast<SIZE_T>(ArrayNum) * Stride;
+
+	if UNLIKELY_IF(bSourceIsElement && ArrayNum == ArrayMax)
+	{
+		const int32 SourceIndex = static_cast<int32>((Source - Data) / Stride);
+
+		Reserve(ArrayNum + 1);
+		Source = Data + static_cast<SIZE_T>(SourceIndex) * Stride;
+	}
+
+	const int32 Index = AddUninitialized(1);
+	Solid::CopyConstructScriptStruct(Handle, Data + static_cast<SIZE_T>(Index) * Stride, Source);
+
+	return Index;
+}
+
+void FSolidStructArray::RemoveAtSwap(const int32 Index)
+{
+	solid_checkf(IsValidIndex(Index), TEXT("FSolidStructArray index %d out of bounds, Num is %d"), Index, ArrayNum);
+
+	uint8* Element = Data + static_cast<SIZE_T>(Index) * Stride;
+	Solid::DestroyScriptStruct(Handle, Element);
+
+	const int32 LastIndex = ArrayNum - 1;
+
+	if (Index != LastIndex)
+	{
+		Solid::RelocateScriptStruct(Handle, Element, Data + static_cast<SIZE_T>(LastIndex) * Stride);
+	}
+
+	--ArrayNum;
+}
+
+void FSolidStructArray::Reset()
+{
+	if (ArrayNum > 0)
+	{
+		Solid::DestroyScriptStruct(Handle, Data, static_cast<uint32>(ArrayNum));
+		ArrayNum = 0;
+	}
+}
+
+void FSolidStructArray::Empty()
+{
+	Reset();
+
+	if (Data)
+	{
+		FMemory::Free(Data);
+		Data = nullptr;
+	}
+
+	ArrayMax = 0;
+}
+
+void FSolidStructArray::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	if (ArrayNum == 0)
+	{
+		return;
+	}
+
+	// nothing to report for structs without object properties or a custom AddStructReferencedObjects
+	if (!Struct->RefLink && !(Struct->StructFlags & STRUCT_AddStructReferencedObjects))
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < ArrayNum; ++Index)
+	{
+		Collector.AddPropertyReferencesWithStructARO(Struct, Data + static_cast<SIZE_T>(Index) * Stride);
+	}
+}
+
+int32 FSolidStructArray::AddUninitialized(const int32 Count)
+{
+	solid_checkf(Handle.IsValid(), TEXT("FSolidStructArray has no struct type!"));
+	solid_checkf(Count >= 0, TEXT("FSolidStructArray cannot add a negative number of elements"));
+
+	const int32 Index = ArrayNum;
+	const int32 NewNum = ArrayNum + Count;
+
+	if (NewNum > ArrayMax)
+	{
+		ResizeAllocation(static_cast<int32>(DefaultCalculateSlackGrow(NewNum, ArrayMax, Stride, true, Alignment)));
+	}
+
+	ArrayNum = NewNum;
+	return Index;
+}
+
+void FSolidStructArray::ResizeAllocation(const int32 NewMax)
+{
+	solid_checkf(Handle.IsValid(), TEXT("FSolidStructArray has no struct type, construct it with one before reserving!"));
+
+	const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo =
+		FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle);
+
+	const SIZE_T NewSize = static_cast<SIZE_T>(NewMax) * Stride;
+
+	if (TypeHookInfo.bIsTriviallyCopyable)
+	{
+		// the allocator may be able to grow in place
+		Data = static_cast<uint8*>(FMemory::Realloc(Data, NewSize, Alignment));
+	}
+	else
+	{
+		uint8* NewData = static_cast<uint8*>(FMemory::Malloc(NewSize, Alignment));
+
+		if (ArrayNum > 0)
+		{
+			Solid::RelocateScriptStruct(Handle, NewData, Data, static_cast<uint32>(ArrayNum));
+		}
+
+		FMemory::Free(Data);
+		Data = NewData;
+	}
+
+	ArrayMax = NewMax;
+}
@@ -0,0 +1,480 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#include "Types/SolidStructPoolAllocator.h"
+
+#include "Algo/BinarySearch.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/StructuredLog.h"
+#include "Misc/ScopeRWLock.h"
+
+#include "SolidMacros.h"
+#include "Diagnostics/SolidShardedCounter.h"
+
+namespace Solid::StructPool::Private
+{
+	// Slabs are sized for this many bytes, but always hold at least MinBlocksPerSlab blocks
+	static constexpr int32 SlabBytes = 64 * 1024;
+	static constexpr int32 MinBlocksPerSlab = 8;
+
+	// Bytes moved between a thread cache and the shared free list at once
+	static constexpr int32 BatchBytes = 16 * 1024;
+	static constexpr int32 MaxBatchSize = 64;
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	}; // struct FFreeBlock
+
+	struct FThreadCache
+	{
+		FStructPool* Pool = nullptr;
+		FFreeBlock* Head = nullptr;
+		int32 Num = 0;
+
+		// Returns the first Count blocks to the pool's shared free list
+		void Flush(const int32 Count)
+		{
+			solid_cassume(Count > 0 && Count <= Num);
+
+			FFreeBlock* ReturnHead = Head;
+			FFreeBlock* ReturnTail = Head;
+
+			for (int32 Index = 1; Index < Count; ++Index)
+			{
+				ReturnTail = ReturnTail->Next;
+			}
+
+			Head = ReturnTail->Next;
+			ReturnTail->Next = nullptr;
+			Num -= Count;
+
+			Pool->ReturnBlocks(ReturnHead, ReturnTail, Count);
+		}
+	}; // struct FThreadCache
+
+	struct FThreadCaches
+	{
+		~FThreadCaches()
+		{
+			// pools live for the whole process, an exiting thread hands its blocks back
+			for (FThreadCache& Cache : Caches)
+			{
+				if (Cache.Num > 0)
+				{
+					Cache.Flush(Cache.Num);
+				}
+			}
+		}
+
+		// Indexed by FStructPool::Index
+		TArray<FThreadCache> Caches;
+	}; // struct FThreadCaches
+
+	static thread_local FThreadCaches ThreadCaches;
+
+	static TShardedCounter<int64> NumAllocations(TEXT("StructPool.Allocations"));
+	static TShardedCounter<int64> NumCacheHits(TEXT("StructPool.CacheHits"));
+	static TShardedCounter<int64> ReservedBytes(TEXT("StructPool.ReservedBytes"));
+
+	static float TrimIntervalSeconds = 30.0f;
+	static FAutoConsoleVariableRef CVarTrimInterval(
+		TEXT("Solid.StructPool.TrimInterval"),
+		TrimIntervalSeconds,
+		TEXT("Seconds between trims of the struct pools, which free slabs with no live block. 0 disables the periodic trim."));
+
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("Solid.StructPool.Dump"),
+		TEXT("Logs the hit rate and memory of every struct pool."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FStructPoolAllocator::Get().Dump();
+		}));
+
+	static FAutoConsoleCommand TrimCommand(
+		TEXT("Solid.StructPool.Trim"),
+		TEXT("Frees every struct pool slab with no live block."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			const int64 Released = FStructPoolAllocator::Get().Trim();
+			UE_LOGFMT(LogSolidMacros, Display, "Struct pools released {Bytes} bytes", Released);
+		}));
+
+	static FTSTicker::FDelegateHandle TrimTickerHandle;
+	static float TimeSinceTrim = 0.0f;
+
+	void Startup()
+	{
+		TrimTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](const float DeltaTime)
+		{
+			if (TrimIntervalSeconds <= 0.0f)
+			{
+				return true;
+			}
+
+			TimeSinceTrim += DeltaTime;
+
+			if (TimeSinceTrim >= TrimIntervalSeconds)
+			{
+				TimeSinceTrim = 0.0f;
+				FStructPoolAllocator::Get().Trim();
+			}
+
+			return true;
+		}));
+	}
+
+	void Shutdown()
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TrimTickerHandle);
+		TrimTickerHandle.Reset();
+	}
+
+} // namespace Solid::StructPool::Private
+
+Solid::FStructPool::FStructPool(const TSolidNotNull<const UScriptStruct*> InStruct, const int32 InIndex)
+	: Struct(InStruct)
+	, Handle(FSolidMoveableStructRegistry::Get().FindHandle(InStruct))
+	, Index(InIndex)
+{
+	using namespace StructPool::Private;
+
+	Alignment = FMath::Max(InStruct->GetMinAlignment(), static_cast<int32>(alignof(FFreeBlock)));
+	BlockSize = Align(FMath::Max(InStruct->GetStructureSize(), static_cast<int32>(sizeof(FFreeBlock))), Alignment);
+	BlocksPerSlab = FMath::Max(SlabBytes / BlockSize, MinBlocksPerSlab);
+	BatchSize = FMath::Clamp(BatchBytes / BlockSize, 1, MaxBatchSize);
+}
+
+void* Solid::FStructPool::Allocate()
+{
+	StructPool::Private::FThreadCache& Cache = GetThreadCache();
+
+	StructPool::Private::NumAllocations.Add(1);
+
+	if LIKELY_IF(Cache.Head)
+	{
+		StructPool::Private::NumCacheHits.Add(1);
+	}
+	else
+	{
+		Refill(Cache);
+	}
+
+	StructPool::Private::FFreeBlock* Block = Cache.Head;
+	Cache.Head = Block->Next;
+	--Cache.Num;
+
+	return Block;
+}
+
+void Solid::FStructPool::Free(void* Block)
+{
+	solid_cassume(Block);
+
+	StructPool::Private::FThreadCache& Cache = GetThreadCache();
+
+	StructPool::Private::FFreeBlock* FreeBlock = static_cast<StructPool::Private::FFreeBlock*>(Block);
+	FreeBlock->Next = Cache.Head;
+	Cache.Head = FreeBlock;
+	++Cache.Num;
+
+	// keep one batch around so alternating allocate and free never ping-pongs with the shared list
+	if UNLIKELY_IF(Cache.Num > BatchSize * 2)
+	{
+		Cache.Flush(BatchSize);
+	}
+}
+
+void* Solid::FStructPool::New()
+{
+	void* Block = Allocate();
+
+	const FSolidMoveableStructRegistry::FStructTypeHookInfo* TypeHookInfo = Handle.IsValid()
+		? &FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle)
+		: nullptr;
+
+	if (TypeHookInfo && (TypeHookInfo->bIsZeroConstructible || TypeHookInfo->DefaultConstructN))
+	{
+		Private::DefaultConstructScriptStruct(*TypeHookInfo, Block, 1);
+	}
+	else
+	{
+		Struct->InitializeStruct(Block);
+	}
+
+	return Block;
+}
+
+void* Solid::FStructPool::MoveNew(void* Src)
+{
+	solid_cassume(Src);
+
+	void* Block = Allocate();
+
+	const FSolidMoveableStructRegistry::FStructTypeHookInfo* TypeHookInfo = Handle.IsValid()
+		? &FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle)
+		: nullptr;
+
+	if (TypeHookInfo && (TypeHookInfo->bIsTriviallyCopyable || TypeHookInfo->MoveConstructN))
+	{
+		Private::MoveConstructScriptStruct(*TypeHookInfo, Block, Src, 1);
+	}
+	else
+	{
+		Struct->InitializeStruct(Block);
+		Struct->CopyScriptStruct(Block, Src);
+	}
+
+	return Block;
+}
+
+void Solid::FStructPool::Delete(void* Block)
+{
+	solid_cassume(Block);
+
+	const FSolidMoveableStructRegistry::FStructTypeHookInfo* TypeHookInfo = Handle.IsValid()
+		? &FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle)
+		: nullptr;
+
+	if (TypeHookInfo && (TypeHookInfo->bIsTriviallyDestructible || TypeHookInfo->DestructN))
+	{
+		Private::DestroyScriptStruct(*TypeHookInfo, Block, 1);
+	}
+	else
+	{
+		Struct->DestroyStruct(Block);
+	}
+
+	Free(Block);
+}
+
+void Solid::FStructPool::FlushThreadCache()
+{
+	StructPool::Private::FThreadCache& Cache = GetThreadCache();
+
+	if (Cache.Num > 0)
+	{
+		Cache.Flush(Cache.Num);
+	}
+}
+
+int64 Solid::FStructPool::Trim()
+{
+	using namespace StructPool::Private;
+
+	FlushThreadCache();
+
+	FScopeLock Lock(&CriticalSection);
+
+	if (Slabs.IsEmpty())
+	{
+		return 0;
+	}
+
+	const auto FindSlabIndex = [this](const FFreeBlock* Block)
+	{
+		return Algo::UpperBound(Slabs, reinterpret_cast<uint8*>(const_cast<FFreeBlock*>(Block))) - 1;
+	};
+
+	TArray<int32, TInlineAllocator<64>> NumFreeBySlab;
+	NumFreeBySlab.SetNumZeroed(Slabs.Num());
+
+	for (const FFreeBlock* Block = FreeList; Block; Block = Block->Next)
+	{
+		++NumFreeBySlab[FindSlabIndex(Block)];
+	}
+
+	// unlink the blocks of every slab about to be freed
+	for (FFreeBlock** Link = &FreeList; *Link;)
+	{
+		if (NumFreeBySlab[FindSlabIndex(*Link)] == BlocksPerSlab)
+		{
+			*Link = (*Link)->Next;
+			--NumFreeBlocks;
+		}
+		else
+		{
+			Link = &(*Link)->Next;
+		}
+	}
+
+	const int64 SlabSize = static_cast<int64>(BlocksPerSlab) * BlockSize;
+	int64 Released = 0;
+
+	for (int32 SlabIndex = Slabs.Num() - 1; SlabIndex >= 0; --SlabIndex)
+	{
+		if (NumFreeBySlab[SlabIndex] == BlocksPerSlab)
+		{
+			FMemory::Free(Slabs[SlabIndex]);
+			Slabs.RemoveAt(SlabIndex, EAllowShrinking::No);
+			Released += SlabSize;
+		}
+	}
+
+	ReservedBytes.Add(-Released);
+	return Released;
+}
+
+Solid::FStructPoolStats Solid::FStructPool::GetStats() const
+{
+	FScopeLock Lock(&CriticalSection);
+
+	FStructPoolStats Stats;
+	Stats.NumSlabs = Slabs.Num();
+	Stats.NumFreeBlocks = NumFreeBlocks;
+	Stats.ReservedBytes = static_cast<int64>(Slabs.Num()) * BlocksPerSlab * BlockSize;
+	Stats.NumRefills = NumRefills;
+
+	return Stats;
+}
+
+void Solid::FStructPool::Refill(StructPool::Private::FThreadCache& Cache)
+{
+	solid_cassume(Cache.Head == nullptr);
+
+	FScopeLock Lock(&CriticalSection);
+
+	++NumRefills;
+
+	if (!FreeList)
+	{
+		AllocateSlab();
+	}
+
+	const int32 Count = FMath::Min(BatchSize, NumFreeBlocks);
+
+	StructPool::Private::FFreeBlock* Tail = FreeList;
+
+	for (int32 BlockIndex = 1; BlockIndex < Count; ++BlockIndex)
+	{
+		Tail = Tail->Next;
+	}
+
+	Cache.Head = FreeList;
+	Cache.Num = Count;
+
+	FreeList = Tail->Next;
+	Tail->Next = nullptr;
+	NumFreeBlocks -= Count;
+}
+
+void Solid::FStructPool::ReturnBlocks(StructPool::Private::FFreeBlock* Head, StructPool::Private::FFreeBlock* Tail,
+                                      const int32 Count)
+{
+	FScopeLock Lock(&CriticalSection);
+
+	Tail->Next = FreeList;
+	FreeList = Head;
+	NumFreeBlocks += Count;
+}
+
+void Solid::FStructPool::AllocateSlab()
+{
+	const SIZE_T SlabSize = static_cast<SIZE_T>(BlocksPerSlab) * BlockSize;
+	uint8* Slab = static_cast<uint8*>(FMemory::Malloc(SlabSize, Alignment));
+
+	Slabs.Insert(Slab, Algo::LowerBound(Slabs, Slab));
+
+	// pushed back to front so the free list hands blocks out in address order
+	for (int32 BlockIndex = BlocksPerSlab - 1; BlockIndex >= 0; --BlockIndex)
+	{
+		StructPool::Private::FFreeBlock* Block =
+			reinterpret_cast<StructPool::Private::FFreeBlock*>(Slab + static_cast<SIZE_T>(BlockIndex) * BlockSize);
+
+		Block->Next = FreeList;
+		FreeList = Block;
+	}
+
+	NumFreeBlocks += BlocksPerSlab;
+	StructPool::Private::ReservedBytes.Add(static_cast<int64>(SlabSize));
+}
+
+Solid::StructPool::Private::FThreadCache& Solid::FStructPool::GetThreadCache()
+{
+	TArray<StructPool::Private::FThreadCache>& Caches = StructPool::Private::ThreadCaches.Caches;
+
+	if UNLIKELY_IF(Index >= Caches.Num())
+	{
+		Caches.SetNum(Index + 1);
+	}
+
+	StructPool::Private::FThreadCache& Cache = Caches.GetData()[Index];
+	Cache.Pool = this;
+
+	return Cache;
+}
+
+Solid::FStructPoolAllocator& Solid::FStructPoolAllocator::Get()
+{
+	static FStructPoolAllocator Allocator;
+	return Allocator;
+}
+
+Solid::FStructPool& Solid::FStructPoolAllocator::GetPool(const TSolidNotNull<const UScriptStruct*> InStruct)
+{
+	{
+		FReadScopeLock ReadLock(Lock);
+
+		if (FStructPool* const* Pool = PoolsByStruct.Find(InStruct.Get()))
+		{
+			return **Pool;
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	if (FStructPool* const* Pool = PoolsByStruct.Find(InStruct.Get()))
+	{
+		return **Pool;
+	}
+
+	// never freed, thread caches of exiting threads may still hand blocks back during shutdown
+	FStructPool* Pool = new FStructPool(InStruct, Pools.Num());
+
+	Pools.Add(Pool);
+	PoolsByStruct.Add(InStruct.Get(), Pool);
+
+	return *Pool;
+}
+
+int64 Solid::FStructPoolAllocator::Trim()
+{
+	TArray<FStructPool*> PoolsToTrim;
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		PoolsToTrim = Pools;
+	}
+
+	int64 Released = 0;
+
+	for (FStructPool* Pool : PoolsToTrim)
+	{
+		Released += Pool->Trim();
+	}
+
+	return Released;
+}
+
+void Solid::FStructPoolAllocator::Dump() const
+{
+	const int64 NumAllocations = StructPool::Private::NumAllocations.Get();
+	const int64 NumCacheHits = StructPool::Private::NumCacheHits.Get();
+
+	UE_LOGFMT(LogSolidMacros, Display, "Struct pools: {Allocations} allocations, {HitRate}% thread cache hits, {Reserved} KiB reserved",
+		NumAllocations,
+		NumAllocations > 0 ? 100.0 * static_cast<double>(NumCacheHits) / static_cast<double>(NumAllocations) : 0.0,
+		StructPool::Private::ReservedBytes.Get() / 1024);
+
+	FReadScopeLock ReadLock(Lock);
+
+	for (const FStructPool* Pool : Pools)
+	{
+		const FStructPoolStats Stats = Pool->GetStats();
+
+		UE_LOGFMT(LogSolidMacros, Display,
+			"  {Struct}: {BlockSize} byte blocks, {Slabs} slabs, {Reserved} KiB reserved, {Free} free blocks, {Refills} refills",
+			Pool->GetScriptStruct()->GetName(), Pool->GetBlockSize(), Stats.NumSlabs, Stats.ReservedBytes / 1024,
+			Stats.NumFreeBlocks, Stats.NumRefills);
+	}
+}
@@ -17,7 +17,9 @@ bool Solid::FPropertyMatchesCDO(const TSolidNotNull<const UObject*> Object,
 
 bool Solid::PropertyMatchesCDO(const TSolidNotNull<const UObject*> Object, const FName PropertyName)
 {
-	if LIKELY_IF(const FProperty* Property = Object->GetClass()->FindPropertyByName(PropertyName))
+	const FProperty* Property = Object->GetClass()->FindPropertyByName(PropertyName);
+
+	if LIKELY_IF(Property)
 	{
 		return FPropertyMatchesCDO(Object, Property);
 	}
@@ -0,0 +1,266 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#include "SolidMacros/Macros.h"
+
+#if IS_MSVC && !IS_CLANG
+#include <intrin.h>
+#endif // IS_MSVC && !IS_CLANG
+
+namespace Solid::Benchmark
+{
+	namespace Private
+	{
+		// Defined out of line so the optimizer cannot see that the pointer is ignored
+		SOLIDMACROS_API void UseCharPointer(const volatile char* Pointer);
+
+	} // namespace Private
+
+	// Forces Value to be materialized, so the computation producing it cannot be removed
+	template <typename T>
+	FORCEINLINE void DoNotOptimize(const T& Value)
+	{
+#if IS_CLANG || IS_GNU
+		asm volatile("" : : "r,m"(Value) : "memory");
+#else // IS_CLANG || IS_GNU
+		Private::UseCharPointer(&reinterpret_cast<const volatile char&>(Value));
+		_ReadWriteBarrier();
+#endif // IS_CLANG || IS_GNU
+	}
+
+	template <typename T>
+	FORCEINLINE void DoNotOptimize(T& Value)
+	{
+#if IS_CLANG
+		asm volatile("" : "+r,m"(Value) : : "memory");
+#elif IS_GNU
+		asm volatile("" : "+m,r"(Value) : : "memory");
+#else // IS_GNU
+		Private::UseCharPointer(&reinterpret_cast<const volatile char&>(Value));
+		_ReadWriteBarrier();
+#endif // IS_CLANG
+	}
+
+	// Forces every pending memory write to be treated as observable
+	FORCEINLINE void ClobberMemory()
+	{
+#if IS_CLANG || IS_GNU
+		asm volatile("" : : : "memory");
+#else // IS_CLANG || IS_GNU
+		_ReadWriteBarrier();
+#endif // IS_CLANG || IS_GNU
+	}
+
+	struct FBenchmarkSettings
+	{
+		// Untimed runs of the body before sampling starts
+		int32 NumWarmupRuns = 3;
+
+		int32 NumSamples = 30;
+
+		// Iterations per sample are doubled until a single sample takes at least this long
+		double MinSampleSeconds = 0.001;
+
+		int64 MaxIterationsPerSample = 1ll << 30;
+
+		// Relative median slowdown against the saved baseline that counts as a regression
+		double RegressionThreshold = 0.10;
+	}; // struct FBenchmarkSettings
+
+	// Timings are per iteration
+	struct SOLIDMACROS_API FBenchmarkResult
+	{
+		FString Name;
+
+		int64 IterationsPerSample = 0;
+		int32 NumSamples = 0;
+
+		double MinNs = 0.0;
+		double MaxNs = 0.0;
+		double MeanNs = 0.0;
+		double MedianNs = 0.0;
+		double P95Ns = 0.0;
+		double P99Ns = 0.0;
+		double StdDevNs = 0.0;
+
+		double MedianCycles = 0.0;
+
+		// Builds the statistics from the raw cycle count of each sample
+		NO_DISCARD static FBenchmarkResult FromSamples(const FString& InName, TArray<uint64> SampleCycles,
+			const int64 InIterationsPerSample);
+	}; // struct FBenchmarkResult
+
+	struct FBenchmarkComparison
+	{
+		double BaselineMedianNs = 0.0;
+		double CurrentMedianNs = 0.0;
+
+		// (Current - Baseline) / Baseline, positive means slower
+		double RelativeChange = 0.0;
+
+		bool bRegressed = false;
+	}; // struct FBenchmarkComparison
+
+	enum class EBenchmarkReportFormat : uint8
+	{
+		Json,
+		Csv,
+	}; // enum class EBenchmarkReportFormat
+
+	NO_DISCARD SOLIDMACROS_API FString ToJson(const TConstArrayView<FBenchmarkResult> Results);
+	NO_DISCARD SOLIDMACROS_API FString ToCsv(const TConstArrayView<FBenchmarkResult> Results);
+	SOLIDMACROS_API bool SaveReport(const FString& FilePath, const TConstArrayView<FBenchmarkResult> Results,
+		const EBenchmarkReportFormat Format);
+
+	SOLIDMACROS_API void LogResult(const FBenchmarkResult& Result);
+
+	// Saved/SolidBenchmarks/
+	NO_DISCARD SOLIDMACROS_API FString GetBenchmarkDirectory();
+	NO_DISCARD SOLIDMACROS_API FString GetBaselinePath(const FString& Name);
+
+	NO_DISCARD SOLIDMACROS_API TOptional<FBenchmarkResult> LoadBaseline(const FString& Name);
+	SOLIDMACROS_API bool SaveBaseline(const FBenchmarkResult& Result);
+
+	NO_DISCARD SOLIDMACROS_API FBenchmarkComparison CompareToBaseline(const FBenchmarkResult& Result,
+		const FBenchmarkResult& Baseline, const double RegressionThreshold);
+
+	/**
+	 * Runs Body repeatedly and returns per-iteration statistics. The body should pass its
+	 * results through DoNotOptimize so the measured work is not optimized away.
+	 */
+	template <typename BodyType>
+	NO_DISCARD FBenchmarkResult Run(const FString& Name, BodyType&& Body,
+		const FBenchmarkSettings& Settings = FBenchmarkSettings())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Name);
+
+		for (int32 RunIndex = 0; RunIndex < Settings.NumWarmupRuns; ++RunIndex)
+		{
+			Body();
+			ClobberMemory();
+		}
+
+		const uint64 MinSampleCycles = static_cast<uint64>(Settings.MinSampleSeconds / FPlatformTime::GetSecondsPerCycle64());
+
+		int64 Iterations = 1;
+
+		for (;;)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			for (int64 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Body();
+			}
+
+			ClobberMemory();
+
+			const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+
+			if (ElapsedCycles >= MinSampleCycles || Iterations >= Settings.MaxIterationsPerSample)
+			{
+				break;
+			}
+
+			Iterations = FMath::Min(Iterations * 2, Settings.MaxIterationsPerSample);
+		}
+
+		TArray<uint64> SampleCycles;
+		SampleCycles.Reserve(Settings.NumSamples);
+
+		for (int32 SampleIndex = 0; SampleIndex < Settings.NumSamples; ++SampleIndex)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			for (int64 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Body();
+			}
+
+			ClobberMemory();
+
+			SampleCycles.Add(FPlatformTime::Cycles64() - StartCycles);
+		}
+
+		return FBenchmarkResult::FromSamples(Name, MoveTemp(SampleCycles), Iterations);
+	}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+	/**
+	 * Passed to SOLID_BENCHMARK_TEST bodies. Every Run is logged and compared against its saved baseline,
+	 * a slowdown above the threshold fails the test. Reports are written when the test finishes.
+	 * Baselines are created on the first run, and refreshed with -SolidBenchmarkUpdateBaseline.
+	 */
+	class SOLIDMACROS_API FBenchmarkContext
+	{
+	public:
+		FBenchmarkContext(FAutomationTestBase& InTest, const FString& InSuiteName);
+
+		template <typename BodyType>
+		const FBenchmarkResult& Run(const FString& Name, BodyType&& Body,
+			const FBenchmarkSettings& Settings = FBenchmarkSettings())
+		{
+			return Record(Benchmark::Run(SuiteName + TEXT(".") + Name, Forward<BodyType>(Body), Settings), Settings);
+		}
+
+		NO_DISCARD FORCEINLINE const TArray<FBenchmarkResult>& GetResults() const
+		{
+			return Results;
+		}
+
+		// Writes the JSON and CSV reports, returns whether the test passed
+		bool Finish();
+
+	private:
+		const FBenchmarkResult& Record(FBenchmarkResult&& Result, const FBenchmarkSettings& Settings);
+
+		FAutomationTestBase& Test;
+		FString SuiteName;
+		TArray<FBenchmarkResult> Results;
+
+	}; // class FBenchmarkContext
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+} // namespace Solid::Benchmark
+
+#ifndef SOLID_BENCHMARK
+#define SOLID_BENCHMARK(Name, ...) \
+	Solid::Benchmark::LogResult(Solid::Benchmark::Run(TEXT(Name), __VA_ARGS__))
+#endif // SOLID_BENCHMARK
+
+#ifndef SOLID_BENCHMARK_TEST
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// SOLID_BENCHMARK_TEST(MoveStructs) { Context.Run(TEXT("Batched"), [&]() { ... }); }
+#define SOLID_BENCHMARK_TEST(TestName) \
+	IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolidBenchmark_##TestName, "Solid.Benchmarks." #TestName, \
+		EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter) \
+	static void SolidBenchmarkBody_##TestName(Solid::Benchmark::FBenchmarkContext& Context); \
+	bool FSolidBenchmark_##TestName::RunTest(const FString& Parameters) \
+	{ \
+		Solid::Benchmark::FBenchmarkContext Context(*this, TEXT(#TestName)); \
+		SolidBenchmarkBody_##TestName(Context); \
+		return Context.Finish(); \
+	} \
+	static void SolidBenchmarkBody_##TestName(Solid::Benchmark::FBenchmarkContext& Context)
+
+#else // WITH_DEV_AUTOMATION_TESTS
+
+// never instantiated, the body only has to parse
+#define SOLID_BENCHMARK_TEST(TestName) \
+	template <typename ContextType> \
+	MAYBE_UNUSED static void SolidBenchmarkBody_##TestName(ContextType& Context)
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+#endif // SOLID_BENCHMARK_TEST
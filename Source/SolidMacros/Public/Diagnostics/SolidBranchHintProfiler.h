@@ -0,0 +1,109 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// Included from SolidMacros/Macros.h while the LIKELY family is being defined,
+// so this header may only depend on engine macros.
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+
+namespace Solid::BranchHints
+{
+	static constexpr int32 SitesPerPage = 256;
+	static constexpr int32 MaxPages = 64;
+	static constexpr int32 MaxSites = SitesPerPage * MaxPages;
+
+	/**
+	 * One per hinted call site, created on the first evaluation. Sites past MaxSites are not tracked.
+	 */
+	struct SOLIDMACROS_API FSite
+	{
+		FSite(const ANSICHAR* InFile, const int32 InLine, const bool bInExpected);
+
+		const ANSICHAR* File;
+		int32 Line;
+
+		// The outcome the hint claims is likely
+		bool bExpected;
+
+		int32 Index;
+	}; // struct FSite
+
+	namespace Private
+	{
+		struct FCounterPage
+		{
+			std::atomic<uint64> Taken[SitesPerPage];
+			std::atomic<uint64> NotTaken[SitesPerPage];
+		}; // struct FCounterPage
+
+		/**
+		 * Counters owned by one thread, only that thread writes them so increments are
+		 * plain relaxed load/store pairs. Pages are allocated when a site on them is first hit.
+		 */
+		struct FThreadCounters
+		{
+			std::atomic<FCounterPage*> Pages[MaxPages];
+		}; // struct FThreadCounters
+
+		// Does not touch ThreadCounters, every module has its own copy of it so the inline caller caches the result
+		SOLIDMACROS_API FThreadCounters& CreateThreadCounters();
+		SOLIDMACROS_API FCounterPage& CreateCounterPage(FThreadCounters& Counters, const int32 PageIndex);
+
+		inline thread_local FThreadCounters* ThreadCounters = nullptr;
+
+		FORCEINLINE void Increment(std::atomic<uint64>& Counter)
+		{
+			Counter.store(Counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+
+	} // namespace Private
+
+	FORCEINLINE bool Record(const FSite& Site, const bool bValue)
+	{
+		if (Site.Index < 0)
+		{
+			return bValue;
+		}
+
+		Private::FThreadCounters* Counters = Private::ThreadCounters;
+
+		if (Counters == nullptr)
+		{
+			Private::ThreadCounters = Counters = &Private::CreateThreadCounters();
+		}
+
+		const int32 PageIndex = Site.Index / SitesPerPage;
+
+		Private::FCounterPage* Page = Counters->Pages[PageIndex].load(std::memory_order_relaxed);
+
+		if (Page == nullptr)
+		{
+			Page = &Private::CreateCounterPage(*Counters, PageIndex);
+		}
+
+		const int32 SlotIndex = Site.Index % SitesPerPage;
+		Private::Increment(bValue ? Page->Taken[SlotIndex] : Page->NotTaken[SlotIndex]);
+
+		return bValue;
+	}
+
+	/**
+	 * Logs every site that was evaluated at least MinSamples times and went against its hint
+	 * in more than MispredictThreshold of them, most mispredicted first.
+	 */
+	SOLIDMACROS_API void Dump(const double MispredictThreshold = 0.5, const uint64 MinSamples = 1000);
+	SOLIDMACROS_API void Reset();
+
+} // namespace Solid::BranchHints
+
+#ifndef SOLID_BRANCH_HINT_RECORD
+#define SOLID_BRANCH_HINT_RECORD(x, bExpected) \
+	([](const bool bValue) -> bool \
+	{ \
+		static const Solid::BranchHints::FSite Site(__FILE__, __LINE__, bExpected); \
+		return Solid::BranchHints::Record(Site, bValue); \
+	}(!!(x)))
+#endif // SOLID_BRANCH_HINT_RECORD
@@ -0,0 +1,75 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// Included from SolidMacros/Macros.h while the solid_check family is being defined,
+// so this header may only depend on engine macros.
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+
+// Hit counts only by default, timing a check with two timestamp reads costs far more than the check itself.
+// Defaulted here rather than in Macros.h so every TU including this header, Macros.h or not, agrees on FScopedCheckTimer's layout
+#ifndef SOLID_PROFILE_CHECK_CYCLES
+#define SOLID_PROFILE_CHECK_CYCLES 0
+#endif // SOLID_PROFILE_CHECK_CYCLES
+
+namespace Solid::CheckProfiler
+{
+	/**
+	 * Static per solid_check* site, links itself into a global list on first evaluation.
+	 */
+	struct SOLIDMACROS_API FCheckSite
+	{
+		FCheckSite(const ANSICHAR* InExpression, const ANSICHAR* InFile, const int32 InLine);
+
+		const ANSICHAR* Expression;
+		const ANSICHAR* File;
+		int32 Line;
+
+		std::atomic<uint64> Count { 0 };
+		std::atomic<uint64> Cycles { 0 };
+
+		FCheckSite* Next = nullptr;
+	}; // struct FCheckSite
+
+	struct FScopedCheckTimer
+	{
+		FORCEINLINE explicit FScopedCheckTimer(FCheckSite& InSite)
+			: Site(InSite)
+#if SOLID_PROFILE_CHECK_CYCLES
+			, StartCycles(FPlatformTime::Cycles64())
+#endif // SOLID_PROFILE_CHECK_CYCLES
+		{
+			Site.Count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		FORCEINLINE ~FScopedCheckTimer()
+		{
+#if SOLID_PROFILE_CHECK_CYCLES
+			Site.Cycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+#endif // SOLID_PROFILE_CHECK_CYCLES
+		}
+
+		FCheckSite& Site;
+
+#if SOLID_PROFILE_CHECK_CYCLES
+		uint64 StartCycles;
+#endif // SOLID_PROFILE_CHECK_CYCLES
+	}; // struct FScopedCheckTimer
+
+	/**
+	 * Logs the NumSites most evaluated check sites. When SOLID_PROFILE_CHECK_CYCLES is defined to 1
+	 * they are ranked by accumulated time instead and the time is logged alongside the count.
+	 */
+	SOLIDMACROS_API void Dump(const int32 NumSites = 20);
+	SOLIDMACROS_API void Reset();
+
+} // namespace Solid::CheckProfiler
+
+#ifndef SOLID_CHECK_PROFILE_SITE
+#define SOLID_CHECK_PROFILE_SITE(expr) \
+	static Solid::CheckProfiler::FCheckSite SolidCheckSite(#expr, __FILE__, __LINE__); \
+	const Solid::CheckProfiler::FScopedCheckTimer SolidCheckTimer(SolidCheckSite)
+#endif // SOLID_CHECK_PROFILE_SITE
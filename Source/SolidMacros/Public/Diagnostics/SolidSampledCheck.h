@@ -0,0 +1,93 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+// Sampled checks stay in every configuration, including shipping
+#ifndef SOLID_SAMPLED_CHECKS_ENABLED
+#define SOLID_SAMPLED_CHECKS_ENABLED 1
+#endif // SOLID_SAMPLED_CHECKS_ENABLED
+
+namespace Solid::SampledCheck
+{
+	struct FSampledCheckFailure
+	{
+		const ANSICHAR* Expression = nullptr;
+		const ANSICHAR* File = nullptr;
+		int32 Line = 0;
+		uint32 ThreadId = 0;
+		uint64 Cycles = 0;
+	}; // struct FSampledCheckFailure
+
+	namespace Private
+	{
+		SOLIDMACROS_API uint32 SeedThreadState();
+
+		inline thread_local uint32 ThreadState = 0;
+
+		// xorshift32 per thread, true for roughly one in Rate calls
+		NO_DISCARD FORCEINLINE bool ShouldSample(const uint32 Rate)
+		{
+			uint32 State = ThreadState;
+
+			if UNLIKELY_IF(State == 0)
+			{
+				State = SeedThreadState();
+			}
+
+			State ^= State << 13;
+			State ^= State >> 17;
+			State ^= State << 5;
+
+			ThreadState = State;
+
+			// State * Rate / 2^32 is zero for 1 / Rate of the uniformly distributed states, without a division
+			return ((static_cast<uint64>(State) * Rate) >> 32) == 0;
+		}
+
+		void Startup();
+		void Shutdown();
+
+	} // namespace Private
+
+	/**
+	 * Records a failed sampled check into a lock-free ring buffer, never blocks.
+	 * When the buffer is full the failure is dropped and counted instead.
+	 */
+	COLD_CODE_PATH SOLIDMACROS_API void ReportFailure(const ANSICHAR* Expression, const ANSICHAR* File, const int32 Line);
+
+	// Drains the recorded failures to the log and the CSV profiler, returns how many were drained
+	SOLIDMACROS_API int32 Flush();
+
+	NO_DISCARD SOLIDMACROS_API uint64 GetNumReported();
+	NO_DISCARD SOLIDMACROS_API uint64 GetNumDropped();
+
+} // namespace Solid::SampledCheck
+
+#if SOLID_SAMPLED_CHECKS_ENABLED
+
+/**
+ * Evaluates expr for roughly one in Rate calls and records a failure instead of halting,
+ * so invariants can be watched under real load in shipping builds.
+ * Failures are flushed periodically, or with Solid.SampledChecks.Flush.
+ */
+#define solid_check_sampled(expr, Rate) \
+	do \
+	{ \
+		if UNLIKELY_IF(Solid::SampledCheck::Private::ShouldSample(Rate)) \
+		{ \
+			if UNLIKELY_IF(!(expr)) \
+			{ \
+				Solid::SampledCheck::ReportFailure(#expr, __FILE__, __LINE__); \
+			} \
+		} \
+	} while (false)
+
+#else // SOLID_SAMPLED_CHECKS_ENABLED
+
+#define solid_check_sampled(expr, Rate) UE_EMPTY
+
+#endif // SOLID_SAMPLED_CHECKS_ENABLED
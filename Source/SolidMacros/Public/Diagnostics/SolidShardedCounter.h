@@ -0,0 +1,340 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+#include "Standard/CacheLine.h"
+
+namespace Solid
+{
+	enum class EShardedCounterOp : uint8
+	{
+		Sum,
+		Min,
+		Max,
+	}; // enum class EShardedCounterOp
+
+	namespace ShardedCounter::Private
+	{
+		static constexpr int32 NumShards = 64;
+		static_assert(FMath::IsPowerOfTwo(NumShards), "NumShards must be a power of two.");
+
+		// Picks the next shard round robin, the inline caller caches it since every module has its own ThreadShard
+		SOLIDMACROS_API int32 AssignThreadShard();
+
+		inline thread_local int32 ThreadShard = INDEX_NONE;
+
+		// Threads are spread round robin, with more threads than shards a few share a line
+		NO_DISCARD FORCEINLINE int32 GetThreadShard()
+		{
+			int32 Shard = ThreadShard;
+
+			if UNLIKELY_IF(Shard == INDEX_NONE)
+			{
+				ThreadShard = Shard = AssignThreadShard();
+			}
+
+			return Shard;
+		}
+
+		void Startup();
+		void Shutdown();
+
+	} // namespace ShardedCounter::Private
+
+	/**
+	 * Registers itself under Name for Solid.Counters.Dump and, when CSV profiling is on,
+	 * records its value to the SolidCounters CSV category once per frame.
+	 * Counters are meant to be globals or statics, they must outlive any thread writing to them.
+	 */
+	class SOLIDMACROS_API FShardedCounterBase
+	{
+	public:
+		explicit FShardedCounterBase(const TCHAR* InName);
+		virtual ~FShardedCounterBase();
+
+		UE_NONCOPYABLE(FShardedCounterBase);
+
+		NO_DISCARD FORCEINLINE const FName& GetName() const
+		{
+			return Name;
+		}
+
+		virtual void Describe(FStringBuilderBase& Builder) const = 0;
+
+		// Single value recorded to the CSV profiler
+		NO_DISCARD virtual double GetCsvValue() const = 0;
+
+		virtual void Reset() = 0;
+
+	private:
+		FName Name;
+	}; // class FShardedCounterBase
+
+	/**
+	 * Counter whose writes go to a cache line owned by the calling thread and are only combined
+	 * when read, so ParallelFor bodies can count events without contending on one atomic.
+	 *
+	 *	static Solid::TShardedCounter<int64> NumVisited(TEXT("Pathing.NumVisited"));
+	 *	NumVisited.Add(1);
+	 */
+	template <typename T, EShardedCounterOp Op = EShardedCounterOp::Sum>
+	class TShardedCounter final : public FShardedCounterBase
+	{
+		static_assert(std::is_arithmetic_v<T>, "TShardedCounter only supports arithmetic types.");
+
+	public:
+		explicit TShardedCounter(const TCHAR* InName)
+			: FShardedCounterBase(InName)
+		{
+			Reset();
+		}
+
+		FORCEINLINE void Add(const T Value)
+		{
+			std::atomic<T>& Shard = *Shards[ShardedCounter::Private::GetThreadShard()];
+
+			if constexpr (Op == EShardedCounterOp::Sum)
+			{
+				if constexpr (std::is_integral_v<T>)
+				{
+					Shard.fetch_add(Value, std::memory_order_relaxed);
+				}
+				else
+				{
+					T Current = Shard.load(std::memory_order_relaxed);
+
+					while (!Shard.compare_exchange_weak(Current, Current + Value, std::memory_order_relaxed))
+					{
+					}
+				}
+			}
+			else
+			{
+				T Current = Shard.load(std::memory_order_relaxed);
+
+				while (Op == EShardedCounterOp::Min ? Value < Current : Value > Current)
+				{
+					if (Shard.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+			}
+		}
+
+		// Combines every shard, relaxed so concurrent writes may or may not be included
+		NO_DISCARD T Get() const
+		{
+			T Result = GetIdentity();
+
+			for (const TPadded<std::atomic<T>>& Shard : Shards)
+			{
+				const T Value = Shard->load(std::memory_order_relaxed);
+
+				if constexpr (Op == EShardedCounterOp::Sum)
+				{
+					Result += Value;
+				}
+				else if constexpr (Op == EShardedCounterOp::Min)
+				{
+					Result = FMath::Min(Result, Value);
+				}
+				else
+				{
+					Result = FMath::Max(Result, Value);
+				}
+			}
+
+			return Result;
+		}
+
+		virtual void Describe(FStringBuilderBase& Builder) const override
+		{
+			Builder << Get();
+		}
+
+		NO_DISCARD virtual double GetCsvValue() const override
+		{
+			return static_cast<double>(Get());
+		}
+
+		virtual void Reset() override
+		{
+			for (TPadded<std::atomic<T>>& Shard : Shards)
+			{
+				Shard->store(GetIdentity(), std::memory_order_relaxed);
+			}
+		}
+
+	private:
+		NO_DISCARD static constexpr T GetIdentity()
+		{
+			if constexpr (Op == EShardedCounterOp::Min)
+			{
+				return TNumericLimits<T>::Max();
+			}
+			else if constexpr (Op == EShardedCounterOp::Max)
+			{
+				return TNumericLimits<T>::Lowest();
+			}
+			else
+			{
+				return T(0);
+			}
+		}
+
+		TPadded<std::atomic<T>> Shards[ShardedCounter::Private::NumShards];
+	}; // class TShardedCounter
+
+	template <typename T>
+	using TShardedMinCounter = TShardedCounter<T, EShardedCounterOp::Min>;
+
+	template <typename T>
+	using TShardedMaxCounter = TShardedCounter<T, EShardedCounterOp::Max>;
+
+	/**
+	 * Power of two histogram, bucket 0 counts zeros and bucket N counts values in [2^(N-1), 2^N).
+	 * The last bucket also takes everything larger.
+	 */
+	template <int32 NumBuckets = 32>
+	class TShardedHistogram final : public FShardedCounterBase
+	{
+		static_assert(NumBuckets > 1 && NumBuckets <= 65, "NumBuckets must be between 2 and 65.");
+
+	public:
+		explicit TShardedHistogram(const TCHAR* InName)
+			: FShardedCounterBase(InName)
+		{
+			Reset();
+		}
+
+		FORCEINLINE void Add(const uint64 Value)
+		{
+			const int32 Bucket = FMath::Min(GetBucket(Value), NumBuckets - 1);
+
+			std::atomic<uint64>& Count = Shards[ShardedCounter::Private::GetThreadShard()]->Counts[Bucket];
+			Count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		NO_DISCARD uint64 GetBucketCount(const int32 Bucket) const
+		{
+			uint64 Count = 0;
+
+			for (const TPadded<FShard>& Shard : Shards)
+			{
+				Count += Shard->Counts[Bucket].load(std::memory_order_relaxed);
+			}
+
+			return Count;
+		}
+
+		NO_DISCARD uint64 GetTotalCount() const
+		{
+			uint64 Total = 0;
+
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				Total += GetBucketCount(Bucket);
+			}
+
+			return Total;
+		}
+
+		// Upper bound of the bucket holding the given percentile, in [0, 1]
+		NO_DISCARD uint64 GetPercentileUpperBound(const double Percentile) const
+		{
+			uint64 Counts[NumBuckets];
+			uint64 Total = 0;
+
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				Counts[Bucket] = GetBucketCount(Bucket);
+				Total += Counts[Bucket];
+			}
+
+			const uint64 Target = static_cast<uint64>(FMath::CeilToDouble(Percentile * static_cast<double>(Total)));
+
+			uint64 Running = 0;
+
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				Running += Counts[Bucket];
+
+				if (Running >= Target && Counts[Bucket] > 0)
+				{
+					return GetBucketUpperBound(Bucket);
+				}
+			}
+
+			return GetBucketUpperBound(NumBuckets - 1);
+		}
+
+		virtual void Describe(FStringBuilderBase& Builder) const override
+		{
+			Builder << TEXT("count ") << GetTotalCount()
+				<< TEXT(", p50 <= ") << GetPercentileUpperBound(0.5)
+				<< TEXT(", p99 <= ") << GetPercentileUpperBound(0.99);
+
+			for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+			{
+				if (const uint64 Count = GetBucketCount(Bucket))
+				{
+					Builder << TEXT(" [<=") << GetBucketUpperBound(Bucket) << TEXT("]=") << Count;
+				}
+			}
+		}
+
+		NO_DISCARD virtual double GetCsvValue() const override
+		{
+			return static_cast<double>(GetPercentileUpperBound(0.5));
+		}
+
+		virtual void Reset() override
+		{
+			for (TPadded<FShard>& Shard : Shards)
+			{
+				for (std::atomic<uint64>& Count : Shard->Counts)
+				{
+					Count.store(0, std::memory_order_relaxed);
+				}
+			}
+		}
+
+	private:
+		struct FShard
+		{
+			std::atomic<uint64> Counts[NumBuckets];
+		}; // struct FShard
+
+		NO_DISCARD static FORCEINLINE int32 GetBucket(const uint64 Value)
+		{
+			return Value == 0 ? 0 : 64 - static_cast<int32>(FPlatformMath::CountLeadingZeros64(Value));
+		}
+
+		NO_DISCARD static constexpr uint64 GetBucketUpperBound(const int32 Bucket)
+		{
+			if (Bucket == NumBuckets - 1 || Bucket >= 64)
+			{
+				return MAX_uint64;
+			}
+
+			return Bucket == 0 ? 0 : (static_cast<uint64>(1) << Bucket) - 1;
+		}
+
+		TPadded<FShard> Shards[ShardedCounter::Private::NumShards];
+	}; // class TShardedHistogram
+
+	namespace ShardedCounter
+	{
+		// Logs every registered counter, optionally only those whose name contains Filter
+		SOLIDMACROS_API void Dump(const FString& Filter = FString());
+		SOLIDMACROS_API void ResetAll();
+
+	} // namespace ShardedCounter
+
+} // namespace Solid
@@ -0,0 +1,129 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <initializer_list>
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+namespace Solid
+{
+	enum class ECpuFeature : uint32
+	{
+		None = 0,
+		SSE42 = 1 << 0,
+		POPCNT = 1 << 1,
+		AVX = 1 << 2,
+		AVX2 = 1 << 3,
+		FMA = 1 << 4,
+		AVX512F = 1 << 5,
+		BMI1 = 1 << 6,
+		BMI2 = 1 << 7,
+		LZCNT = 1 << 8,
+	}; // enum class ECpuFeature
+
+	ENUM_CLASS_FLAGS(ECpuFeature);
+
+	/**
+	 * Instruction set extensions of the running CPU, probed once through cpuid/xgetbv.
+	 * AVX and AVX-512 are only reported when the OS also saves their register state.
+	 * Always empty on non x86 platforms.
+	 */
+	struct SOLIDMACROS_API FCpuFeatures
+	{
+		// Probes on first use, the module also probes eagerly on startup
+		NO_DISCARD static const FCpuFeatures& Get();
+
+		NO_DISCARD FORCEINLINE static bool Has(const ECpuFeature Required)
+		{
+			return EnumHasAllFlags(Get().Features, Required);
+		}
+
+		NO_DISCARD FString ToString() const;
+
+		ECpuFeature Features = ECpuFeature::None;
+
+	private:
+		NO_DISCARD static FCpuFeatures Detect();
+	}; // struct FCpuFeatures
+
+	/**
+	 * Picks the best implementation of a kernel for the running CPU the first time it is called
+	 * and calls through the cached function pointer afterwards.
+	 * Candidates are listed best first, the last one should require ECpuFeature::None.
+	 *
+	 *	static Solid::TCpuDispatch<int32(const uint8*, int32)> CountZeros {
+	 *		{ Solid::ECpuFeature::AVX2, &CountZerosAVX2 },
+	 *		{ Solid::ECpuFeature::None, &CountZerosScalar } };
+	 */
+	template <typename FunctionType>
+	class TCpuDispatch;
+
+	template <typename ReturnType, typename... ArgTypes>
+	class TCpuDispatch<ReturnType(ArgTypes...)>
+	{
+	public:
+		using FFunctionPtr = ReturnType(*)(ArgTypes...);
+
+		static constexpr int32 MaxCandidates = 8;
+
+		struct FCandidate
+		{
+			ECpuFeature Required;
+			FFunctionPtr Function;
+		}; // struct FCandidate
+
+		TCpuDispatch(std::initializer_list<FCandidate> InCandidates)
+		{
+			solid_checkf(InCandidates.size() > 0 && InCandidates.size() <= MaxCandidates,
+				TEXT("TCpuDispatch needs between 1 and %d candidates"), MaxCandidates);
+
+			for (const FCandidate& Candidate : InCandidates)
+			{
+				Candidates[NumCandidates++] = Candidate;
+			}
+		}
+
+		FORCEINLINE ReturnType operator()(ArgTypes... Args) const
+		{
+			FFunctionPtr Function = Resolved.load(std::memory_order_relaxed);
+
+			if UNLIKELY_IF(Function == nullptr)
+			{
+				Function = Resolve();
+			}
+
+			return Function(Forward<ArgTypes>(Args)...);
+		}
+
+		NO_DISCARD FFunctionPtr Resolve() const
+		{
+			const FCpuFeatures& CpuFeatures = FCpuFeatures::Get();
+
+			FFunctionPtr Function = Candidates[NumCandidates - 1].Function;
+
+			for (int32 Index = 0; Index < NumCandidates; ++Index)
+			{
+				if (EnumHasAllFlags(CpuFeatures.Features, Candidates[Index].Required))
+				{
+					Function = Candidates[Index].Function;
+					break;
+				}
+			}
+
+			// every thread resolves to the same pointer, so racing stores are harmless
+			Resolved.store(Function, std::memory_order_relaxed);
+			return Function;
+		}
+
+	private:
+		FCandidate Candidates[MaxCandidates] = {};
+		int32 NumCandidates = 0;
+
+		mutable std::atomic<FFunctionPtr> Resolved { nullptr };
+	}; // class TCpuDispatch
+
+} // namespace Solid
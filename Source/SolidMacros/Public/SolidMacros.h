@@ -5,10 +5,15 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+SOLIDMACROS_API DECLARE_LOG_CATEGORY_EXTERN(LogSolidMacros, Log, All);
+
 class FSolidMacrosModule : public IModuleInterface
 {
 public:
 	
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	FDelegateHandle CompiledInUObjectsRegisteredHandle;
 }; // class FSolidMacrosModule
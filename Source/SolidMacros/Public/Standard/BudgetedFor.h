@@ -0,0 +1,145 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// ReSharper disable CppUE4CodingStandardNamingViolationWarning
+#ifndef SOLID_BUDGETED_FOR_H
+#define SOLID_BUDGETED_FOR_H
+
+#include "CoreMinimal.h"
+
+#include "HAL/PlatformTime.h"
+
+#include "SolidMacros/Macros.h"
+
+namespace Solid
+{
+    struct SOLIDMACROS_API FBudgetedForStats
+    {
+        uint64 TotalIterations = 0;
+        uint64 TotalCycles = 0;
+        uint64 NumTicks = 0;
+
+        uint64 LastTickIterations = 0;
+        uint64 LastTickCycles = 0;
+        uint64 MaxTickCycles = 0;
+
+        // Exponential moving average of the cost of a single iteration, 0 until the first tick
+        double AverageCyclesPerIteration = 0.0;
+
+        NO_DISCARD double GetAverageMicrosecondsPerIteration() const;
+        NO_DISCARD double GetLastTickMicroseconds() const;
+        NO_DISCARD double GetMaxTickMicroseconds() const;
+    }; // struct FBudgetedForStats
+
+    /**
+     * A resumable loop over [Min, Max) that runs until a time budget is spent and continues
+     * from the same index on the next call, so long scans can be spread across frames:
+     *
+     *	if (RebuildLoop.Execute(500.0, [&](const int64 Index) { RebuildEntry(Index); }))
+     *	{
+     *		// done
+     *	}
+     *
+     * Time is only sampled every few iterations, the interval is derived from the measured cost
+     * per iteration so cheap bodies are not dominated by FPlatformTime::Cycles64 calls.
+     * At least one iteration runs per call, so the loop always makes progress.
+     */
+    class SOLIDMACROS_API FBudgetedFor
+    {
+    public:
+        FBudgetedFor() = default;
+        FBudgetedFor(const int64 InMin, const int64 InMax);
+
+        // Restarts the loop over a new range, cost statistics are kept as they still describe the body
+        void Reset(const int64 InMin, const int64 InMax);
+        void ResetStats();
+
+        /**
+         * Runs Function(Index) from the stored cursor until the budget is spent or the range is done.
+         * @return true once every index has been visited.
+         */
+        template <typename FunctionType>
+        bool Execute(const double BudgetMicroseconds, FunctionType&& Function)
+        {
+            if UNLIKELY_IF(IsComplete())
+            {
+                return true;
+            }
+
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            const uint64 BudgetCycles = MicrosecondsToCycles(BudgetMicroseconds);
+            const uint64 DeadlineCycles = StartCycles + BudgetCycles;
+            const int64 IterationsPerCheck = GetIterationsPerTimeCheck(BudgetCycles);
+            const int64 StartCursor = Cursor;
+
+            uint64 NowCycles = StartCycles;
+
+            do
+            {
+                const int64 BatchEnd = FMath::Min(Cursor + IterationsPerCheck, Max);
+
+                for (; Cursor < BatchEnd; ++Cursor)
+                {
+                    Function(Cursor);
+                }
+
+                NowCycles = FPlatformTime::Cycles64();
+            }
+            while (Cursor < Max && NowCycles < DeadlineCycles);
+
+            RecordTick(static_cast<uint64>(Cursor - StartCursor), NowCycles - StartCycles);
+
+            return IsComplete();
+        }
+
+        NO_DISCARD FORCEINLINE bool IsComplete() const
+        {
+            return Cursor >= Max;
+        }
+
+        NO_DISCARD FORCEINLINE int64 GetCursor() const
+        {
+            return Cursor;
+        }
+
+        NO_DISCARD FORCEINLINE int64 GetRemaining() const
+        {
+            return FMath::Max<int64>(Max - Cursor, 0);
+        }
+
+        // 0..1
+        NO_DISCARD float GetProgress() const;
+
+        NO_DISCARD FORCEINLINE const FBudgetedForStats& GetStats() const
+        {
+            return Stats;
+        }
+
+        // How many iterations fit in the given budget, based on the measured cost so far
+        NO_DISCARD int64 EstimateIterationsForBudget(const double BudgetMicroseconds) const;
+        NO_DISCARD double EstimateRemainingMicroseconds() const;
+
+        /**
+         * Budget needed to finish the remaining range in NumTicks calls, clamped to [MinMicroseconds, MaxMicroseconds].
+         * Returns MaxMicroseconds until a cost has been measured.
+         */
+        NO_DISCARD double GetAdaptiveBudgetMicroseconds(const int32 NumTicks,
+            const double MinMicroseconds, const double MaxMicroseconds) const;
+
+        NO_DISCARD static uint64 MicrosecondsToCycles(const double Microseconds);
+        NO_DISCARD static double CyclesToMicroseconds(const uint64 Cycles);
+
+    private:
+        NO_DISCARD int64 GetIterationsPerTimeCheck(const uint64 BudgetCycles) const;
+        void RecordTick(const uint64 Iterations, const uint64 Cycles);
+
+        int64 Min = 0;
+        int64 Max = 0;
+        int64 Cursor = 0;
+
+        FBudgetedForStats Stats;
+
+    }; // class FBudgetedFor
+
+} // namespace Solid
+
+#endif // SOLID_BUDGETED_FOR_H
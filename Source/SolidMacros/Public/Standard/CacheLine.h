@@ -0,0 +1,101 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// ReSharper disable CppUE4CodingStandardNamingViolationWarning
+#ifndef SOLID_CACHE_LINE_H
+#define SOLID_CACHE_LINE_H
+
+#include <new>
+#include <utility>
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+namespace Solid
+{
+    // GCC warns that the standard constant may change between compiler versions, so it only
+    // sizes types with the platform cache line there
+#if defined(__cpp_lib_hardware_interference_size) && !(IS_GNU && !IS_CLANG)
+    inline constexpr SIZE_T DestructiveInterferenceSize = std::hardware_destructive_interference_size;
+#else // defined(__cpp_lib_hardware_interference_size) && !(IS_GNU && !IS_CLANG)
+    inline constexpr SIZE_T DestructiveInterferenceSize = SOLID_CACHE_LINE_SIZE;
+#endif // defined(__cpp_lib_hardware_interference_size) && !(IS_GNU && !IS_CLANG)
+
+    /**
+     * Gives Value a cache line to itself, for per thread or per block state that is written
+     * concurrently and would otherwise false share with its neighbours in an array.
+     */
+    template <typename T>
+    struct alignas(DestructiveInterferenceSize) TPadded
+    {
+        TPadded() = default;
+
+        template <typename... ArgTypes>
+        explicit TPadded(EInPlace, ArgTypes&&... Args)
+            : Value(std::forward<ArgTypes>(Args)...)
+        {
+        }
+
+        NO_DISCARD FORCEINLINE T& operator*()
+        {
+            return Value;
+        }
+
+        NO_DISCARD FORCEINLINE const T& operator*() const
+        {
+            return Value;
+        }
+
+        NO_DISCARD FORCEINLINE T* operator->()
+        {
+            return &Value;
+        }
+
+        NO_DISCARD FORCEINLINE const T* operator->() const
+        {
+            return &Value;
+        }
+
+        T Value {};
+    }; // struct TPadded
+
+    /**
+     * Prefetches every cache line of [Data, Data + NumBytes) for reading. Meant to run a fixed
+     * distance ahead of a streaming loop, a few hundred bytes to a few kilobytes.
+     */
+    template <int32 Locality = 3>
+    FORCEINLINE void PrefetchRange(const void* Data, const SIZE_T NumBytes)
+    {
+        static_assert(Locality >= 0 && Locality <= 3, "Locality must be between 0 and 3.");
+
+        const uint8* Bytes = static_cast<const uint8*>(Data);
+
+        for (SIZE_T Offset = 0; Offset < NumBytes; Offset += SOLID_CACHE_LINE_SIZE)
+        {
+            SOLID_PREFETCH_READ(Bytes + Offset, Locality);
+        }
+    }
+
+    template <int32 Locality = 3, typename ElementType>
+    FORCEINLINE void PrefetchRange(const ElementType* Data, const int64 Num)
+    {
+        PrefetchRange<Locality>(static_cast<const void*>(Data), static_cast<SIZE_T>(Num) * sizeof(ElementType));
+    }
+
+    // Same as PrefetchRange, but asks for the lines in a writable state
+    template <int32 Locality = 3>
+    FORCEINLINE void PrefetchRangeForWrite(void* Data, const SIZE_T NumBytes)
+    {
+        static_assert(Locality >= 0 && Locality <= 3, "Locality must be between 0 and 3.");
+
+        uint8* Bytes = static_cast<uint8*>(Data);
+
+        for (SIZE_T Offset = 0; Offset < NumBytes; Offset += SOLID_CACHE_LINE_SIZE)
+        {
+            SOLID_PREFETCH_WRITE(Bytes + Offset, Locality);
+        }
+    }
+
+} // namespace Solid
+
+#endif // SOLID_CACHE_LINE_H
@@ -4,15 +4,21 @@
 #ifndef SOLID_FOR_H
 #define SOLID_FOR_H
 
+#include <tuple>
+#include <utility>
+
 #include "CoreMinimal.h"
 
+#include "SolidMacros/Macros.h"
+#include "Standard/CacheLine.h"
+
 namespace Solid
 {
+    // constrained rather than asserted, an unconstrained MaxType is as good a match as the container overloads below
     template <typename MaxType, typename FunctionType>
+    requires (std::is_integral_v<MaxType>)
     FORCEINLINE constexpr void For(const MaxType Max, FunctionType Function)
     {
-        static_assert(std::is_integral_v<MaxType>, "MaxType must be an integral type.");
-        
         for (MaxType Index = 0; Index < Max; ++Index)
         {
             Function(Index);
@@ -42,12 +48,55 @@ namespace Solid
         InType.Num();
     }; // concept THasNumConcept
 
+    namespace Private
+    {
+        template <typename ContainerType>
+        requires (THasNumConcept<ContainerType> || THasSizeConcept<ContainerType>)
+        NO_DISCARD FORCEINLINE constexpr auto GetContainerNum(const ContainerType& Container)
+        {
+            if constexpr (THasNumConcept<ContainerType>)
+            {
+                return Container.Num();
+            }
+            else
+            {
+                return Container.size();
+            }
+        }
+
+        template <typename ContainerType>
+        NO_DISCARD FORCEINLINE auto* GetContainerData(ContainerType& Container)
+        {
+            if constexpr (requires { Container.GetData(); })
+            {
+                return Container.GetData();
+            }
+            else
+            {
+                return Container.data();
+            }
+        }
+
+        // Every container has to match the first one, checked once before the loop
+        template <typename FirstContainerType, typename... ContainerTypes>
+        NO_DISCARD FORCEINLINE auto GetZipNum(const FirstContainerType& First, const ContainerTypes&... Containers)
+        {
+            const auto Num = GetContainerNum(First);
+
+            solid_checkf(((static_cast<int64>(GetContainerNum(Containers)) == static_cast<int64>(Num)) && ...),
+                TEXT("ForZip: every container must have the same number of elements!"));
+
+            return Num;
+        }
+
+    } // namespace Private
+
     template <THasSizeConcept ContainerType, typename FunctionType>
     FORCEINLINE constexpr void For(const ContainerType& Container, FunctionType Function)
     {
-        constexpr auto Size = Container.size();
+        const auto Size = Container.size();
         
-        for (decltype(Size) Index = 0; Index < Size; ++Index)
+        for (std::remove_const_t<decltype(Size)> Index = 0; Index < Size; ++Index)
         {
             Function(Index, Container[Index]);
         }
@@ -56,9 +105,9 @@ namespace Solid
     template <THasNumConcept ContainerType, typename FunctionType>
     FORCEINLINE constexpr void For(const ContainerType& Container, FunctionType Function)
     {
-        constexpr auto Size = Container.Num();
+        const auto Size = Container.Num();
         
-        for (decltype(Size) Index = 0; Index < Size; ++Index)
+        for (std::remove_const_t<decltype(Size)> Index = 0; Index < Size; ++Index)
         {
             Function(Index, Container[Index]);
         }
@@ -107,6 +156,275 @@ namespace Solid
         ForEachTupleImpl<Start, End, Tuple, FunctionType>(
             Function, std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<Tuple>>>{});
     }
+
+    /**
+     * Calls Function(Index) for [0, Count), unrolled Factor times with a plain remainder loop.
+     * Sits between Solid::For and the fully unrolled Solid::ForEach<Num> for runtime counts.
+     */
+    template <std::size_t Factor, typename CountType, typename FunctionType>
+    requires (std::is_integral_v<CountType>)
+    FORCEINLINE constexpr void ForUnrolled(const CountType Count, FunctionType Function)
+    {
+        static_assert(Factor > 0, "Factor must be greater than zero.");
+
+        if (Count <= 0)
+        {
+            return;
+        }
+
+        const CountType UnrolledEnd = Count - (Count % static_cast<CountType>(Factor));
+
+        CountType Index = 0;
+
+        for (; Index < UnrolledEnd; Index += static_cast<CountType>(Factor))
+        {
+            ForEach<Factor>([&Function, Index](const auto Offset)
+            {
+                Function(static_cast<CountType>(Index + static_cast<CountType>(Offset)));
+            });
+        }
+
+        for (; Index < Count; ++Index)
+        {
+            Function(Index);
+        }
+    }
+
+    /**
+     * Calls Function(BaseIndex, Width) once per batch of Lanes indices. Width is a std::integral_constant,
+     * so the functor's inner loop over [BaseIndex, BaseIndex + Width) has a compile-time trip count.
+     * Full batches receive Lanes, the remainder is passed one index at a time with a width of 1.
+     */
+    template <std::size_t Lanes, typename CountType, typename FunctionType>
+    requires (std::is_integral_v<CountType>)
+    FORCEINLINE constexpr void ForStrided(const CountType Count, FunctionType Function)
+    {
+        static_assert(Lanes > 0, "Lanes must be greater than zero.");
+
+        if (Count <= 0)
+        {
+            return;
+        }
+
+        const CountType StridedEnd = Count - (Count % static_cast<CountType>(Lanes));
+
+        CountType Index = 0;
+
+        for (; Index < StridedEnd; Index += static_cast<CountType>(Lanes))
+        {
+            Function(Index, std::integral_constant<std::size_t, Lanes>{});
+        }
+
+        for (; Index < Count; ++Index)
+        {
+            Function(Index, std::integral_constant<std::size_t, 1>{});
+        }
+    }
+
+    namespace Private
+    {
+        template <std::size_t Factor, typename ElementType, typename FunctionType>
+        FORCEINLINE void ForUnrolledRestrict(ElementType* SOLID_RESTRICT Data, const int32 Num, FunctionType& Function)
+        {
+            const int32 UnrolledEnd = Num - (Num % static_cast<int32>(Factor));
+
+            int32 Index = 0;
+
+            for (; Index < UnrolledEnd; Index += static_cast<int32>(Factor))
+            {
+                [&]<std::size_t... Offsets>(std::index_sequence<Offsets...>)
+                {
+                    (Function(Data[Index + static_cast<int32>(Offsets)]), ...);
+                }(std::make_index_sequence<Factor>{});
+            }
+
+            for (; Index < Num; ++Index)
+            {
+                Function(Data[Index]);
+            }
+        }
+
+        template <std::size_t Factor, typename DestType, typename SourceType, typename FunctionType>
+        FORCEINLINE void ForUnrolledRestrict(DestType* SOLID_RESTRICT Dest, SourceType* SOLID_RESTRICT Source,
+                                             const int32 Num, FunctionType& Function)
+        {
+            const int32 UnrolledEnd = Num - (Num % static_cast<int32>(Factor));
+
+            int32 Index = 0;
+
+            for (; Index < UnrolledEnd; Index += static_cast<int32>(Factor))
+            {
+                [&]<std::size_t... Offsets>(std::index_sequence<Offsets...>)
+                {
+                    (Function(Dest[Index + static_cast<int32>(Offsets)], Source[Index + static_cast<int32>(Offsets)]), ...);
+                }(std::make_index_sequence<Factor>{});
+            }
+
+            for (; Index < Num; ++Index)
+            {
+                Function(Dest[Index], Source[Index]);
+            }
+        }
+
+        template <std::size_t Lanes, typename ElementType, typename FunctionType>
+        FORCEINLINE void ForStridedRestrict(ElementType* SOLID_RESTRICT Data, const int32 Num, FunctionType& Function)
+        {
+            const int32 StridedEnd = Num - (Num % static_cast<int32>(Lanes));
+
+            int32 Index = 0;
+
+            for (; Index < StridedEnd; Index += static_cast<int32>(Lanes))
+            {
+                Function(Data + Index, std::integral_constant<std::size_t, Lanes>{});
+            }
+
+            for (; Index < Num; ++Index)
+            {
+                Function(Data + Index, std::integral_constant<std::size_t, 1>{});
+            }
+        }
+
+        template <int32 PrefetchDistance, typename ElementType, typename FunctionType>
+        FORCEINLINE void ForStreamingRestrict(ElementType* SOLID_RESTRICT Data, const int32 Num, FunctionType& Function)
+        {
+            constexpr int32 ElementsPerLine = FMath::Max(1, static_cast<int32>(SOLID_CACHE_LINE_SIZE / sizeof(ElementType)));
+            constexpr int32 PrefetchElements = FMath::Max(1, PrefetchDistance / static_cast<int32>(sizeof(ElementType)));
+
+            int32 Index = 0;
+
+            // one prefetch per cache line, for the line PrefetchDistance bytes ahead
+            for (; Index + PrefetchElements < Num; Index += ElementsPerLine)
+            {
+                PrefetchRange<0>(Data + Index + PrefetchElements, static_cast<int64>(FMath::Min(ElementsPerLine, Num - Index - PrefetchElements)));
+
+                const int32 LineEnd = FMath::Min(Index + ElementsPerLine, Num);
+
+                for (int32 LineIndex = Index; LineIndex < LineEnd; ++LineIndex)
+                {
+                    Function(Data[LineIndex]);
+                }
+            }
+
+            for (; Index < Num; ++Index)
+            {
+                Function(Data[Index]);
+            }
+        }
+
+    } // namespace Private
+
+    /**
+     * Array view variants, the data pointers are hoisted into SOLID_RESTRICT locals
+     * so the compiler is free to vectorize the unrolled body. TArrays are forwarded below,
+     * other contiguous containers have to go through MakeArrayView.
+     */
+    template <std::size_t Factor, typename ElementType, typename FunctionType>
+    FORCEINLINE void ForUnrolled(const TArrayView<ElementType> View, FunctionType Function)
+    {
+        static_assert(Factor > 0, "Factor must be greater than zero.");
+
+        Private::ForUnrolledRestrict<Factor>(View.GetData(), View.Num(), Function);
+    }
+
+    // Dest and Source must not overlap
+    template <std::size_t Factor, typename DestType, typename SourceType, typename FunctionType>
+    FORCEINLINE void ForUnrolled(const TArrayView<DestType> Dest, const TArrayView<SourceType> Source, FunctionType Function)
+    {
+        static_assert(Factor > 0, "Factor must be greater than zero.");
+
+        solid_checkf(Dest.Num() == Source.Num(), TEXT("ForUnrolled: Dest and Source must have the same number of elements!"));
+
+        Private::ForUnrolledRestrict<Factor>(Dest.GetData(), Source.GetData(), Dest.Num(), Function);
+    }
+
+    // Calls Function(BatchData, Width), where BatchData points at the first of Width elements
+    template <std::size_t Lanes, typename ElementType, typename FunctionType>
+    FORCEINLINE void ForStrided(const TArrayView<ElementType> View, FunctionType Function)
+    {
+        static_assert(Lanes > 0, "Lanes must be greater than zero.");
+
+        Private::ForStridedRestrict<Lanes>(View.GetData(), View.Num(), Function);
+    }
+
+    /**
+     * Visits every element once while prefetching PrefetchDistance bytes ahead as non-temporal,
+     * for passes over arrays too large to stay in cache. Prefer ForUnrolled when the data is warm.
+     */
+    template <int32 PrefetchDistance = 512, typename ElementType, typename FunctionType>
+    FORCEINLINE void ForStreaming(const TArrayView<ElementType> View, FunctionType Function)
+    {
+        static_assert(PrefetchDistance > 0, "PrefetchDistance must be greater than zero.");
+
+        Private::ForStreamingRestrict<PrefetchDistance>(View.GetData(), View.Num(), Function);
+    }
+
+    template <std::size_t Factor, typename ArrayType, typename FunctionType>
+    requires (TIsTArray<std::remove_cvref_t<ArrayType>>::Value)
+    FORCEINLINE void ForUnrolled(ArrayType&& Array, FunctionType Function)
+    {
+        ForUnrolled<Factor>(MakeArrayView(Array), Function);
+    }
+
+    template <std::size_t Factor, typename DestArrayType, typename SourceArrayType, typename FunctionType>
+    requires (TIsTArray<std::remove_cvref_t<DestArrayType>>::Value && TIsTArray<std::remove_cvref_t<SourceArrayType>>::Value)
+    FORCEINLINE void ForUnrolled(DestArrayType&& Dest, SourceArrayType&& Source, FunctionType Function)
+    {
+        ForUnrolled<Factor>(MakeArrayView(Dest), MakeArrayView(Source), Function);
+    }
+
+    template <std::size_t Lanes, typename ArrayType, typename FunctionType>
+    requires (TIsTArray<std::remove_cvref_t<ArrayType>>::Value)
+    FORCEINLINE void ForStrided(ArrayType&& Array, FunctionType Function)
+    {
+        ForStrided<Lanes>(MakeArrayView(Array), Function);
+    }
+
+    template <int32 PrefetchDistance = 512, typename ArrayType, typename FunctionType>
+    requires (TIsTArray<std::remove_cvref_t<ArrayType>>::Value)
+    FORCEINLINE void ForStreaming(ArrayType&& Array, FunctionType Function)
+    {
+        ForStreaming<PrefetchDistance>(MakeArrayView(Array), Function);
+    }
+
+    namespace Private
+    {
+        // [Begin, End) of the zipped containers, ParallelForZip runs one call per chunk
+        template <typename IndexType, typename FunctionType, typename... ElementTypes>
+        FORCEINLINE void ForZipRestrict(const IndexType Begin, const IndexType End, FunctionType& Function,
+                                        ElementTypes* SOLID_RESTRICT... Data)
+        {
+            for (IndexType Index = Begin; Index < End; ++Index)
+            {
+                Function(Index, Data[Index]...);
+            }
+        }
+
+        template <typename ArgumentTupleType, std::size_t... Indices>
+        FORCEINLINE void ForZipImpl(ArgumentTupleType& Arguments, std::index_sequence<Indices...>)
+        {
+            auto& Function = std::get<sizeof...(Indices)>(Arguments);
+
+            const auto Num = GetZipNum(std::get<Indices>(Arguments)...);
+
+            ForZipRestrict<std::remove_const_t<decltype(Num)>>(0, Num, Function, GetContainerData(std::get<Indices>(Arguments))...);
+        }
+
+    } // namespace Private
+
+    /**
+     * Iterates parallel containers in lockstep, ForZip(Positions, Velocities, Flags, Function) calls
+     * Function(Index, Positions[Index], Velocities[Index], Flags[Index]). Lengths are checked once and the
+     * raw data pointers are hoisted into SOLID_RESTRICT parameters, so the containers must not alias.
+     */
+    template <typename... ArgumentTypes>
+    FORCEINLINE void ForZip(ArgumentTypes&&... Arguments)
+    {
+        static_assert(sizeof...(ArgumentTypes) >= 2, "ForZip needs at least one container and a function.");
+
+        auto ArgumentTuple = std::forward_as_tuple(Arguments...);
+
+        Private::ForZipImpl(ArgumentTuple, std::make_index_sequence<sizeof...(ArgumentTypes) - 1>{});
+    }
     
 } // namespace Solid
 
@@ -0,0 +1,206 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// ReSharper disable CppUE4CodingStandardNamingViolationWarning
+#ifndef SOLID_FOR_EACH_SET_BIT_H
+#define SOLID_FOR_EACH_SET_BIT_H
+
+#include <type_traits>
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+
+#ifndef SOLID_BIT_SCAN_AVX2
+
+#if defined(__AVX2__)
+
+#define SOLID_BIT_SCAN_AVX2 1
+
+#else // defined(__AVX2__)
+
+#define SOLID_BIT_SCAN_AVX2 0
+
+#endif // defined(__AVX2__)
+
+#endif // SOLID_BIT_SCAN_AVX2
+
+#if SOLID_BIT_SCAN_AVX2
+#include <immintrin.h>
+#endif // SOLID_BIT_SCAN_AVX2
+
+namespace Solid
+{
+    template <typename WordType>
+    concept TBitWordConcept = std::is_unsigned_v<WordType> && (sizeof(WordType) == 4 || sizeof(WordType) == 8);
+
+    namespace Private
+    {
+        template <TBitWordConcept WordType>
+        NO_DISCARD FORCEINLINE int32 CountTrailingZerosWord(const WordType Word)
+        {
+            if constexpr (sizeof(WordType) == 8)
+            {
+                return static_cast<int32>(FPlatformMath::CountTrailingZeros64(Word));
+            }
+            else
+            {
+                return static_cast<int32>(FPlatformMath::CountTrailingZeros(Word));
+            }
+        }
+
+        template <TBitWordConcept WordType>
+        NO_DISCARD FORCEINLINE int32 CountSetBitsWord(const WordType Word)
+        {
+            return static_cast<int32>(FPlatformMath::CountBits(static_cast<uint64>(Word)));
+        }
+
+        // Returns the index of the first 32 byte block with a bit set, or NumBlocks.
+        // Picks the AVX2 or scalar kernel for the running CPU, see Solid::TCpuDispatch.
+        NO_DISCARD SOLIDMACROS_API int32 FindFirstNonZeroBlock(const uint8* Data, const int32 NumBlocks);
+
+        // Returns the first word at or after StartWord that has a bit set, or NumWords
+        template <TBitWordConcept WordType>
+        NO_DISCARD FORCEINLINE int32 FindNextNonZeroWord(const WordType* Words, int32 StartWord, const int32 NumWords)
+        {
+#if SOLID_BIT_SCAN_AVX2
+            // skip empty regions 256 bits at a time
+            constexpr int32 WordsPerVector = static_cast<int32>(sizeof(__m256i) / sizeof(WordType));
+
+            while (StartWord + WordsPerVector <= NumWords)
+            {
+                const __m256i Vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Words + StartWord));
+
+                if (!_mm256_testz_si256(Vector, Vector))
+                {
+                    break;
+                }
+
+                StartWord += WordsPerVector;
+            }
+#elif PLATFORM_CPU_X86_FAMILY
+            // not compiled for AVX2, long empty runs are worth the call into the dispatched kernel
+            constexpr int32 WordsPerBlock = static_cast<int32>(32 / sizeof(WordType));
+            const int32 NumBlocks = (NumWords - StartWord) / WordsPerBlock;
+
+            if (NumBlocks >= 4 && Words[StartWord] == 0)
+            {
+                StartWord += FindFirstNonZeroBlock(reinterpret_cast<const uint8*>(Words + StartWord), NumBlocks) * WordsPerBlock;
+            }
+#endif // SOLID_BIT_SCAN_AVX2
+
+            while (StartWord < NumWords && Words[StartWord] == 0)
+            {
+                ++StartWord;
+            }
+
+            return StartWord;
+        }
+
+    } // namespace Private
+
+    /**
+     * Calls Function(BitIndex) for every set bit in a single mask, lowest bit first.
+     */
+    template <TBitWordConcept WordType, typename FunctionType>
+    FORCEINLINE void ForEachSetBit(WordType Mask, FunctionType Function)
+    {
+        while (Mask != 0)
+        {
+            Function(Private::CountTrailingZerosWord(Mask));
+
+            // clear the lowest set bit
+            Mask &= Mask - 1;
+        }
+    }
+
+    /**
+     * Calls Function(BitIndex) for every set bit in [0, NumBits) of a word range.
+     * Zero words are skipped without looking at their bits, and each set bit costs one tzcnt.
+     */
+    template <TBitWordConcept WordType, typename FunctionType>
+    void ForEachSetBit(const WordType* Words, const int32 NumBits, FunctionType Function)
+    {
+        constexpr int32 BitsPerWord = static_cast<int32>(sizeof(WordType) * 8);
+
+        if UNLIKELY_IF(NumBits <= 0)
+        {
+            return;
+        }
+
+        solid_cassume(Words);
+
+        const int32 NumWords = FMath::DivideAndRoundUp(NumBits, BitsPerWord);
+        const int32 NumFullWords = NumBits / BitsPerWord;
+
+        for (int32 WordIndex = Private::FindNextNonZeroWord(Words, 0, NumWords);
+             WordIndex < NumWords;
+             WordIndex = Private::FindNextNonZeroWord(Words, WordIndex + 1, NumWords))
+        {
+            WordType Word = Words[WordIndex];
+
+            // mask off the slack bits past NumBits in the last word
+            if (WordIndex == NumFullWords)
+            {
+                Word &= (static_cast<WordType>(1) << (NumBits % BitsPerWord)) - 1;
+            }
+
+            const int32 BaseIndex = WordIndex * BitsPerWord;
+
+            ForEachSetBit(Word, [&Function, BaseIndex](const int32 BitIndex)
+            {
+                Function(BaseIndex + BitIndex);
+            });
+        }
+    }
+
+    template <TBitWordConcept WordType, typename FunctionType>
+    FORCEINLINE void ForEachSetBit(const TArrayView<const WordType> Words, FunctionType Function)
+    {
+        ForEachSetBit(Words.GetData(), Words.Num() * static_cast<int32>(sizeof(WordType) * 8), MoveTemp(Function));
+    }
+
+    template <typename AllocatorType, typename FunctionType>
+    FORCEINLINE void ForEachSetBit(const TBitArray<AllocatorType>& Bits, FunctionType Function)
+    {
+        ForEachSetBit(Bits.GetData(), Bits.Num(), MoveTemp(Function));
+    }
+
+    // popcnt over [0, NumBits) of a word range
+    template <TBitWordConcept WordType>
+    NO_DISCARD int32 CountSetBits(const WordType* Words, const int32 NumBits)
+    {
+        constexpr int32 BitsPerWord = static_cast<int32>(sizeof(WordType) * 8);
+
+        if UNLIKELY_IF(NumBits <= 0)
+        {
+            return 0;
+        }
+
+        solid_cassume(Words);
+
+        const int32 NumFullWords = NumBits / BitsPerWord;
+
+        int32 Count = 0;
+
+        for (int32 WordIndex = 0; WordIndex < NumFullWords; ++WordIndex)
+        {
+            Count += Private::CountSetBitsWord(Words[WordIndex]);
+        }
+
+        if (const int32 SlackBits = NumBits % BitsPerWord)
+        {
+            Count += Private::CountSetBitsWord(static_cast<WordType>(Words[NumFullWords] & ((static_cast<WordType>(1) << SlackBits) - 1)));
+        }
+
+        return Count;
+    }
+
+    template <typename AllocatorType>
+    NO_DISCARD FORCEINLINE int32 CountSetBits(const TBitArray<AllocatorType>& Bits)
+    {
+        return CountSetBits(Bits.GetData(), Bits.Num());
+    }
+
+} // namespace Solid
+
+#endif // SOLID_FOR_EACH_SET_BIT_H
@@ -0,0 +1,368 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// ReSharper disable CppUE4CodingStandardNamingViolationWarning
+#ifndef SOLID_PARALLEL_FOR_H
+#define SOLID_PARALLEL_FOR_H
+
+#include <atomic>
+#include <bit>
+#include <tuple>
+
+#include "CoreMinimal.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+#include "Tasks/Task.h"
+
+#include "SolidMacros/Macros.h"
+#include "Standard/For.h"
+
+namespace Solid
+{
+    enum class EParallelForFlags : uint8
+    {
+        None = 0,
+        // Always run on the calling thread, useful for debugging races
+        ForceSingleThreaded = 1 << 0,
+        // Launch the helper tasks at background priority
+        BackgroundPriority = 1 << 1,
+    }; // enum class EParallelForFlags
+
+    ENUM_CLASS_FLAGS(EParallelForFlags)
+
+    struct FParallelForSettings
+    {
+        // Ranges with fewer iterations than this run serially on the calling thread
+        int64 SerialThreshold = 1024;
+
+        // Lower bound for the number of iterations a worker claims at once
+        int64 MinChunkSize = 64;
+
+        // Chunks are sized as Remaining / (NumWorkers * ChunksPerWorker), so that
+        // early chunks are large and the tail is split finely between idle workers
+        int32 ChunksPerWorker = 4;
+
+        // Upper bound for the number of workers including the calling thread, 0 uses every task graph worker
+        int32 MaxWorkers = 0;
+
+        EParallelForFlags Flags = EParallelForFlags::None;
+    }; // struct FParallelForSettings
+
+    namespace Private
+    {
+        NO_DISCARD FORCEINLINE int32 GetParallelForNumWorkers(const int64 Count, const FParallelForSettings& Settings)
+        {
+            if (Count < Settings.SerialThreshold
+                || EnumHasAnyFlags(Settings.Flags, EParallelForFlags::ForceSingleThreaded)
+                || !FApp::ShouldUseThreadingForPerformance())
+            {
+                return 1;
+            }
+
+            // the calling thread works on the range as well
+            int64 MaxWorkers = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+            if (Settings.MaxWorkers > 0)
+            {
+                MaxWorkers = FMath::Min<int64>(MaxWorkers, Settings.MaxWorkers);
+            }
+
+            const int64 MaxUsefulWorkers = FMath::DivideAndRoundUp(Count, FMath::Max<int64>(Settings.MinChunkSize, 1));
+
+            return static_cast<int32>(FMath::Clamp<int64>(FMath::Min(MaxWorkers, MaxUsefulWorkers), 1, MAX_int32));
+        }
+
+        /**
+         * Runs RangeFunction(Begin, End) over chunks covering [Min, Max) across NumWorkers workers.
+         * Workers pull chunks from a shared cursor, so a worker that finishes early keeps stealing
+         * the remaining chunks instead of idling while a slower worker drains a fixed partition.
+         */
+        template <typename IndexType, typename RangeFunctionType>
+        void ParallelForRangeImpl(const IndexType Min, const IndexType Max, RangeFunctionType& RangeFunction,
+                                  const FParallelForSettings& Settings)
+        {
+            const int64 Count = static_cast<int64>(Max) - static_cast<int64>(Min);
+
+            if UNLIKELY_IF(Count <= 0)
+            {
+                return;
+            }
+
+            const int32 NumWorkers = GetParallelForNumWorkers(Count, Settings);
+
+            if (NumWorkers <= 1)
+            {
+                RangeFunction(Min, Max);
+                return;
+            }
+
+            const int64 MinChunkSize = FMath::Max<int64>(Settings.MinChunkSize, 1);
+            const int64 ChunkDivisor = static_cast<int64>(NumWorkers) * FMath::Max(Settings.ChunksPerWorker, 1);
+
+            alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int64> Cursor { 0 };
+
+            auto Worker = [&Cursor, &RangeFunction, Count, MinChunkSize, ChunkDivisor, Min]()
+            {
+                int64 Start = Cursor.load(std::memory_order_relaxed);
+
+                while (Start < Count)
+                {
+                    const int64 Remaining = Count - Start;
+                    const int64 ChunkSize = FMath::Min(FMath::Max(Remaining / ChunkDivisor, MinChunkSize), Remaining);
+
+                    // on failure Start is reloaded with the current cursor
+                    if (!Cursor.compare_exchange_weak(Start, Start + ChunkSize, std::memory_order_relaxed))
+                    {
+                        continue;
+                    }
+
+                    RangeFunction(static_cast<IndexType>(Min + Start), static_cast<IndexType>(Min + Start + ChunkSize));
+
+                    Start = Cursor.load(std::memory_order_relaxed);
+                }
+            };
+
+            const UE::Tasks::ETaskPriority Priority = EnumHasAnyFlags(Settings.Flags, EParallelForFlags::BackgroundPriority)
+                ? UE::Tasks::ETaskPriority::BackgroundNormal
+                : UE::Tasks::ETaskPriority::Normal;
+
+            TArray<UE::Tasks::FTask, TInlineAllocator<32>> Tasks;
+            Tasks.Reserve(NumWorkers - 1);
+
+            for (int32 WorkerIndex = 1; WorkerIndex < NumWorkers; ++WorkerIndex)
+            {
+                Tasks.Emplace(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&Worker]() { Worker(); }, Priority));
+            }
+
+            Worker();
+
+            // the captured state lives on this stack frame, so every helper must finish before returning
+            UE::Tasks::Wait(Tasks);
+        }
+
+        // Runs Function(Index) for every Index in [Min, Max)
+        template <typename IndexType, typename FunctionType>
+        FORCEINLINE void ParallelForImpl(const IndexType Min, const IndexType Max, FunctionType& Function,
+                                         const FParallelForSettings& Settings)
+        {
+            auto RangeFunction = [&Function](const IndexType Begin, const IndexType End)
+            {
+                for (IndexType Index = Begin; Index < End; ++Index)
+                {
+                    Function(Index);
+                }
+            };
+
+            ParallelForRangeImpl(Min, Max, RangeFunction, Settings);
+        }
+
+    } // namespace Private
+
+    /**
+     * Parallel counterpart of Solid::For, switching a loop over is a matter of renaming the call.
+     * Function must be safe to invoke concurrently for distinct indices.
+     */
+    template <typename MaxType, typename FunctionType>
+    requires (std::is_integral_v<MaxType>)
+    FORCEINLINE void ParallelFor(const MaxType Max, FunctionType Function,
+                                 const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        Private::ParallelForImpl(static_cast<MaxType>(0), Max, Function, Settings);
+    }
+
+    template <typename MinType, typename MaxType, typename FunctionType>
+    requires (std::is_integral_v<MaxType>)
+    FORCEINLINE void ParallelFor(const MinType Min, const MaxType Max, FunctionType Function,
+                                 const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        static_assert(std::is_integral_v<MinType> && std::is_integral_v<MaxType>, "MinType and MaxType must be integral types.");
+
+        Private::ParallelForImpl(Min, static_cast<MinType>(Max), Function, Settings);
+    }
+
+    template <THasSizeConcept ContainerType, typename FunctionType>
+    FORCEINLINE void ParallelFor(ContainerType& Container, FunctionType Function,
+                                 const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        using SizeType = decltype(Container.size());
+
+        auto Body = [&Container, &Function](const SizeType Index)
+        {
+            Function(Index, Container[Index]);
+        };
+
+        Private::ParallelForImpl(static_cast<SizeType>(0), Container.size(), Body, Settings);
+    }
+
+    template <THasNumConcept ContainerType, typename FunctionType>
+    FORCEINLINE void ParallelFor(ContainerType& Container, FunctionType Function,
+                                 const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        using SizeType = decltype(Container.Num());
+
+        auto Body = [&Container, &Function](const SizeType Index)
+        {
+            Function(Index, Container[Index]);
+        };
+
+        Private::ParallelForImpl(static_cast<SizeType>(0), Container.Num(), Body, Settings);
+    }
+
+    namespace Private
+    {
+        template <std::size_t NumElements>
+        NO_DISCARD consteval uint64 GetTupleElementMask()
+        {
+            static_assert(NumElements <= 64, "ForEachTupleParallel supports at most 64 tuple elements.");
+
+            return NumElements == 64 ? MAX_uint64 : (static_cast<uint64>(1) << NumElements) - 1;
+        }
+
+        // Single threaded fallback, keeps the parallel ordering: the masked group first, then the rest
+        template <uint64 ConcurrentMask, typename TupleType, typename FunctionType, std::size_t... Indices>
+        FORCEINLINE void ForEachTupleSerialImpl(TupleType& InTuple, FunctionType& Function, std::index_sequence<Indices...>)
+        {
+            ([&]()
+            {
+                if constexpr ((ConcurrentMask & (static_cast<uint64>(1) << Indices)) != 0)
+                {
+                    Function(std::get<Indices>(InTuple));
+                }
+            }(), ...);
+
+            ([&]()
+            {
+                if constexpr ((ConcurrentMask & (static_cast<uint64>(1) << Indices)) == 0)
+                {
+                    Function(std::get<Indices>(InTuple));
+                }
+            }(), ...);
+        }
+
+        template <uint64 ConcurrentMask, typename TupleType, typename FunctionType, std::size_t... Indices>
+        void ForEachTupleParallelImpl(TupleType& InTuple, FunctionType& Function,
+                                      const UE::Tasks::ETaskPriority Priority, std::index_sequence<Indices...>)
+        {
+            constexpr int32 NumConcurrent = std::popcount(ConcurrentMask);
+
+            // the last concurrent element runs on the calling thread instead of in its own task
+            constexpr uint64 InlineElementBit = std::bit_floor(ConcurrentMask);
+
+            TArray<UE::Tasks::FTask, TInlineAllocator<NumConcurrent - 1>> Tasks;
+
+            ([&]()
+            {
+                constexpr uint64 ElementBit = static_cast<uint64>(1) << Indices;
+
+                if constexpr ((ConcurrentMask & ElementBit) != 0 && ElementBit != InlineElementBit)
+                {
+                    Tasks.Emplace(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&InTuple, &Function]()
+                    {
+                        Function(std::get<Indices>(InTuple));
+                    }, Priority));
+                }
+            }(), ...);
+
+            Function(std::get<std::countr_zero(InlineElementBit)>(InTuple));
+
+            UE::Tasks::Wait(Tasks);
+
+            // elements outside the mask depend on the concurrent group and run afterwards, in order
+            ([&]()
+            {
+                if constexpr ((ConcurrentMask & (static_cast<uint64>(1) << Indices)) == 0)
+                {
+                    Function(std::get<Indices>(InTuple));
+                }
+            }(), ...);
+        }
+
+    } // namespace Private
+
+    /**
+     * Parallel counterpart of Solid::ForEachTuple, every element whose bit is set in ConcurrentMask
+     * is visited in its own task and joined before returning. Elements outside the mask run serially
+     * on the calling thread once the concurrent group has finished. With one or no concurrent elements,
+     * or when running single threaded, the masked elements are visited serially first and the rest after them.
+     * Function must be safe to invoke concurrently for distinct elements.
+     */
+    template <uint64 ConcurrentMask = MAX_uint64, typename TupleType, typename FunctionType>
+    void ForEachTupleParallel(TupleType&& InTuple, FunctionType Function,
+                              const EParallelForFlags Flags = EParallelForFlags::None)
+    {
+        constexpr std::size_t NumElements = std::tuple_size_v<std::remove_cvref_t<TupleType>>;
+        constexpr uint64 Mask = ConcurrentMask & Private::GetTupleElementMask<NumElements>();
+
+        if constexpr (std::popcount(Mask) <= 1)
+        {
+            Private::ForEachTupleSerialImpl<Mask>(InTuple, Function, std::make_index_sequence<NumElements>{});
+        }
+        else
+        {
+            if (EnumHasAnyFlags(Flags, EParallelForFlags::ForceSingleThreaded) || !FApp::ShouldUseThreadingForPerformance())
+            {
+                Private::ForEachTupleSerialImpl<Mask>(InTuple, Function, std::make_index_sequence<NumElements>{});
+                return;
+            }
+
+            const UE::Tasks::ETaskPriority Priority = EnumHasAnyFlags(Flags, EParallelForFlags::BackgroundPriority)
+                ? UE::Tasks::ETaskPriority::BackgroundNormal
+                : UE::Tasks::ETaskPriority::Normal;
+
+            Private::ForEachTupleParallelImpl<Mask>(InTuple, Function, Priority, std::make_index_sequence<NumElements>{});
+        }
+    }
+
+    namespace Private
+    {
+        template <typename ArgumentTupleType, std::size_t... Indices>
+        FORCEINLINE void ParallelForZipImpl(ArgumentTupleType& Arguments, const FParallelForSettings& Settings,
+                                            std::index_sequence<Indices...>)
+        {
+            auto& Function = std::get<sizeof...(Indices)>(Arguments);
+
+            const auto Num = GetZipNum(std::get<Indices>(Arguments)...);
+            using IndexType = std::remove_const_t<decltype(Num)>;
+
+            // every chunk runs ForZip's SOLID_RESTRICT loop, the pointers captured here are only handed to it
+            auto RangeFunction = [&Function, ...Data = GetContainerData(std::get<Indices>(Arguments))](const IndexType Begin, const IndexType End)
+            {
+                ForZipRestrict<IndexType>(Begin, End, Function, Data...);
+            };
+
+            ParallelForRangeImpl(static_cast<IndexType>(0), Num, RangeFunction, Settings);
+        }
+
+    } // namespace Private
+
+    /**
+     * Parallel counterpart of Solid::ForZip, Function must be safe to invoke concurrently for distinct indices.
+     * Like every other ParallelFor overload it takes an optional trailing FParallelForSettings:
+     * ParallelForZip(Positions, Velocities, Function, Settings).
+     */
+    template <typename... ArgumentTypes>
+    FORCEINLINE void ParallelForZip(ArgumentTypes&&... Arguments)
+    {
+        constexpr std::size_t NumArguments = sizeof...(ArgumentTypes);
+
+        auto ArgumentTuple = std::forward_as_tuple(Arguments...);
+
+        if constexpr (std::is_same_v<std::remove_cvref_t<std::tuple_element_t<NumArguments - 1, std::tuple<ArgumentTypes...>>>,
+                                     FParallelForSettings>)
+        {
+            static_assert(NumArguments >= 3, "ParallelForZip needs at least one container, a function and the settings.");
+
+            Private::ParallelForZipImpl(ArgumentTuple, std::get<NumArguments - 1>(ArgumentTuple),
+                                        std::make_index_sequence<NumArguments - 2>{});
+        }
+        else
+        {
+            static_assert(NumArguments >= 2, "ParallelForZip needs at least one container and a function.");
+
+            Private::ParallelForZipImpl(ArgumentTuple, FParallelForSettings(), std::make_index_sequence<NumArguments - 1>{});
+        }
+    }
+
+} // namespace Solid
+
+#endif // SOLID_PARALLEL_FOR_H
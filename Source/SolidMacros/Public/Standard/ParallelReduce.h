@@ -0,0 +1,369 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+// ReSharper disable CppUE4CodingStandardNamingViolationWarning
+#ifndef SOLID_PARALLEL_REDUCE_H
+#define SOLID_PARALLEL_REDUCE_H
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+#include "Standard/CacheLine.h"
+#include "Standard/For.h"
+#include "Standard/ParallelFor.h"
+
+namespace Solid
+{
+    enum class EScanType : uint8
+    {
+        // Output[i] includes Input[i]
+        Inclusive,
+        // Output[i] is the combination of every element before Input[i], starting with Init
+        Exclusive,
+    }; // enum class EScanType
+
+    namespace Private
+    {
+        // One accumulator per block, padded so neighbouring blocks never write to the same cache line
+        template <typename ValueType>
+        using TParallelPartial = TPadded<ValueType>;
+
+        struct FParallelBlocks
+        {
+            int64 NumBlocks = 1;
+            int64 BlockSize = 0;
+
+            NO_DISCARD FORCEINLINE int64 GetBegin(const int64 Block) const
+            {
+                return Block * BlockSize;
+            }
+
+            NO_DISCARD FORCEINLINE int64 GetEnd(const int64 Block, const int64 Count) const
+            {
+                return FMath::Min(GetBegin(Block) + BlockSize, Count);
+            }
+        }; // struct FParallelBlocks
+
+        /**
+         * Splits Count into a fixed set of contiguous blocks. Blocks are combined in order afterwards,
+         * so results only require an associative (not commutative) combine and are deterministic
+         * regardless of which worker ran which block.
+         */
+        NO_DISCARD FORCEINLINE FParallelBlocks MakeParallelBlocks(const int64 Count, const FParallelForSettings& Settings)
+        {
+            FParallelBlocks Blocks;
+
+            const int32 NumWorkers = GetParallelForNumWorkers(Count, Settings);
+
+            const int64 DesiredBlocks = NumWorkers <= 1
+                ? 1
+                : static_cast<int64>(NumWorkers) * FMath::Max(Settings.ChunksPerWorker, 1);
+
+            Blocks.BlockSize = FMath::Max(FMath::DivideAndRoundUp(Count, DesiredBlocks), FMath::Max<int64>(Settings.MinChunkSize, 1));
+            Blocks.NumBlocks = FMath::DivideAndRoundUp(Count, Blocks.BlockSize);
+
+            return Blocks;
+        }
+
+        NO_DISCARD FORCEINLINE FParallelForSettings MakeBlockSettings(const FParallelForSettings& Settings)
+        {
+            FParallelForSettings BlockSettings = Settings;
+            BlockSettings.SerialThreshold = 2;
+            BlockSettings.MinChunkSize = 1;
+
+            return BlockSettings;
+        }
+
+        /**
+         * BlockFunction(Begin, End) reduces the non-empty range [Begin, End) serially,
+         * the per-block results are then folded left to right with Combine.
+         */
+        template <typename ValueType, typename BlockFunctionType, typename CombineType>
+        NO_DISCARD ValueType ReduceBlocks(const int64 Count, BlockFunctionType& BlockFunction, CombineType& Combine,
+                                          const FParallelForSettings& Settings)
+        {
+            static_assert(std::is_default_constructible_v<ValueType>, "ValueType must be default constructible to be reduced in parallel.");
+
+            solid_cassume(Count > 0);
+
+            const FParallelBlocks Blocks = MakeParallelBlocks(Count, Settings);
+
+            if (Blocks.NumBlocks <= 1)
+            {
+                return BlockFunction(static_cast<int64>(0), Count);
+            }
+
+            TArray<TParallelPartial<ValueType>, TInlineAllocator<64>> Partials;
+            Partials.SetNum(static_cast<int32>(Blocks.NumBlocks));
+
+            auto RunBlock = [&Partials, &BlockFunction, &Blocks, Count](const int64 Block)
+            {
+                Partials[static_cast<int32>(Block)].Value = BlockFunction(Blocks.GetBegin(Block), Blocks.GetEnd(Block, Count));
+            };
+
+            ParallelForImpl(static_cast<int64>(0), Blocks.NumBlocks, RunBlock, MakeBlockSettings(Settings));
+
+            ValueType Result = MoveTemp(Partials[0].Value);
+
+            for (int32 Block = 1; Block < Partials.Num(); ++Block)
+            {
+                Result = Combine(MoveTemp(Result), MoveTemp(Partials[Block].Value));
+            }
+
+            return Result;
+        }
+
+        template <EScanType ScanType, typename ValueType, typename LoadType, typename StoreType, typename CombineType>
+        FORCEINLINE void ScanRange(const int64 Begin, const int64 End, ValueType Accumulator,
+                                   LoadType& Load, StoreType& Store, CombineType& Combine)
+        {
+            for (int64 Index = Begin; Index < End; ++Index)
+            {
+                // load before storing so in-place scans are safe
+                ValueType Value = Load(Index);
+
+                if constexpr (ScanType == EScanType::Inclusive)
+                {
+                    Accumulator = Combine(MoveTemp(Accumulator), MoveTemp(Value));
+                    Store(Index, Accumulator);
+                }
+                else
+                {
+                    Store(Index, Accumulator);
+                    Accumulator = Combine(MoveTemp(Accumulator), MoveTemp(Value));
+                }
+            }
+        }
+
+        /**
+         * Two pass scan: reduce every block, prefix the block totals serially,
+         * then rescan every block starting from its offset.
+         */
+        template <EScanType ScanType, typename ValueType, typename LoadType, typename StoreType, typename CombineType>
+        void ParallelScanImpl(const int64 Count, const ValueType& Init, LoadType& Load, StoreType& Store,
+                              CombineType& Combine, const FParallelForSettings& Settings)
+        {
+            static_assert(std::is_default_constructible_v<ValueType>, "ValueType must be default constructible to be scanned in parallel.");
+
+            if UNLIKELY_IF(Count <= 0)
+            {
+                return;
+            }
+
+            const FParallelBlocks Blocks = MakeParallelBlocks(Count, Settings);
+
+            if (Blocks.NumBlocks <= 1)
+            {
+                ScanRange<ScanType>(0, Count, Init, Load, Store, Combine);
+                return;
+            }
+
+            const FParallelForSettings BlockSettings = MakeBlockSettings(Settings);
+
+            TArray<TParallelPartial<ValueType>, TInlineAllocator<64>> Partials;
+            Partials.SetNum(static_cast<int32>(Blocks.NumBlocks));
+
+            auto ReduceBlock = [&Partials, &Blocks, &Load, &Combine, Count](const int64 Block)
+            {
+                const int64 Begin = Blocks.GetBegin(Block);
+                const int64 End = Blocks.GetEnd(Block, Count);
+
+                ValueType Accumulator = Load(Begin);
+
+                for (int64 Index = Begin + 1; Index < End; ++Index)
+                {
+                    Accumulator = Combine(MoveTemp(Accumulator), Load(Index));
+                }
+
+                Partials[static_cast<int32>(Block)].Value = MoveTemp(Accumulator);
+            };
+
+            ParallelForImpl(static_cast<int64>(0), Blocks.NumBlocks, ReduceBlock, BlockSettings);
+
+            // turn the block totals into the exclusive offset every block starts from
+            ValueType Offset = Init;
+
+            for (int32 Block = 0; Block < Partials.Num(); ++Block)
+            {
+                ValueType Next = Combine(Offset, MoveTemp(Partials[Block].Value));
+                Partials[Block].Value = MoveTemp(Offset);
+                Offset = MoveTemp(Next);
+            }
+
+            auto ScanBlock = [&Partials, &Blocks, &Load, &Store, &Combine, Count](const int64 Block)
+            {
+                ScanRange<ScanType>(Blocks.GetBegin(Block), Blocks.GetEnd(Block, Count),
+                    Partials[static_cast<int32>(Block)].Value, Load, Store, Combine);
+            };
+
+            ParallelForImpl(static_cast<int64>(0), Blocks.NumBlocks, ScanBlock, BlockSettings);
+        }
+
+    } // namespace Private
+
+    /**
+     * Reduces [Min, Max) by accumulating into per-block copies of Identity through Body(Accumulator, Index),
+     * then folds the block results with Combine(A, B).
+     */
+    template <typename MinType, typename MaxType, typename ValueType, typename BodyType, typename CombineType>
+    requires (std::is_integral_v<MinType> && std::is_integral_v<MaxType>)
+    NO_DISCARD ValueType ParallelReduce(const MinType Min, const MaxType Max, const ValueType& Identity,
+                                        BodyType Body, CombineType Combine,
+                                        const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        const int64 Count = static_cast<int64>(Max) - static_cast<int64>(Min);
+
+        if UNLIKELY_IF(Count <= 0)
+        {
+            return Identity;
+        }
+
+        auto BlockFunction = [&Identity, &Body, Min](const int64 Begin, const int64 End) -> ValueType
+        {
+            ValueType Accumulator = Identity;
+
+            for (int64 Offset = Begin; Offset < End; ++Offset)
+            {
+                Body(Accumulator, static_cast<MinType>(Min + Offset));
+            }
+
+            return Accumulator;
+        };
+
+        return Private::ReduceBlocks<ValueType>(Count, BlockFunction, Combine, Settings);
+    }
+
+    template <typename MaxType, typename ValueType, typename BodyType, typename CombineType>
+    requires (std::is_integral_v<MaxType>)
+    NO_DISCARD FORCEINLINE ValueType ParallelReduce(const MaxType Max, const ValueType& Identity,
+                                                    BodyType Body, CombineType Combine,
+                                                    const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        return ParallelReduce(static_cast<MaxType>(0), Max, Identity, MoveTemp(Body), MoveTemp(Combine), Settings);
+    }
+
+    /**
+     * Parallel std::transform_reduce over [Min, Max): returns Init combined with Transform(Index) of every index.
+     */
+    template <typename MinType, typename MaxType, typename ValueType, typename ReduceType, typename TransformType>
+    requires (std::is_integral_v<MinType> && std::is_integral_v<MaxType>)
+    NO_DISCARD ValueType ParallelTransformReduce(const MinType Min, const MaxType Max, ValueType Init,
+                                                 ReduceType Reduce, TransformType Transform,
+                                                 const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        const int64 Count = static_cast<int64>(Max) - static_cast<int64>(Min);
+
+        if UNLIKELY_IF(Count <= 0)
+        {
+            return Init;
+        }
+
+        auto BlockFunction = [&Reduce, &Transform, Min](const int64 Begin, const int64 End) -> ValueType
+        {
+            ValueType Accumulator = Transform(static_cast<MinType>(Min + Begin));
+
+            for (int64 Offset = Begin + 1; Offset < End; ++Offset)
+            {
+                Accumulator = Reduce(MoveTemp(Accumulator), Transform(static_cast<MinType>(Min + Offset)));
+            }
+
+            return Accumulator;
+        };
+
+        return Reduce(MoveTemp(Init), Private::ReduceBlocks<ValueType>(Count, BlockFunction, Reduce, Settings));
+    }
+
+    template <typename MaxType, typename ValueType, typename ReduceType, typename TransformType>
+    requires (std::is_integral_v<MaxType>)
+    NO_DISCARD FORCEINLINE ValueType ParallelTransformReduce(const MaxType Max, ValueType Init,
+                                                             ReduceType Reduce, TransformType Transform,
+                                                             const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        return ParallelTransformReduce(static_cast<MaxType>(0), Max, MoveTemp(Init), MoveTemp(Reduce), MoveTemp(Transform), Settings);
+    }
+
+    template <typename ContainerType, typename ValueType, typename ReduceType, typename TransformType>
+    requires (THasNumConcept<ContainerType> || THasSizeConcept<ContainerType>)
+    NO_DISCARD FORCEINLINE ValueType ParallelTransformReduce(const ContainerType& Container, ValueType Init,
+                                                             ReduceType Reduce, TransformType Transform,
+                                                             const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        const auto Num = Private::GetContainerNum(Container);
+
+        return ParallelTransformReduce(static_cast<decltype(Num)>(0), Num, MoveTemp(Init), MoveTemp(Reduce),
+            [&Container, &Transform](const auto Index) -> ValueType
+            {
+                return Transform(Container[Index]);
+            }, Settings);
+    }
+
+    template <typename ContainerType, typename ValueType, typename ReduceType>
+    requires (THasNumConcept<ContainerType> || THasSizeConcept<ContainerType>)
+    NO_DISCARD FORCEINLINE ValueType ParallelReduce(const ContainerType& Container, ValueType Init, ReduceType Reduce,
+                                                    const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        const auto Num = Private::GetContainerNum(Container);
+
+        return ParallelTransformReduce(static_cast<decltype(Num)>(0), Num, MoveTemp(Init), MoveTemp(Reduce),
+            [&Container](const auto Index) -> ValueType
+            {
+                return Container[Index];
+            }, Settings);
+    }
+
+    /**
+     * Scans [Min, Max), reading every element through Load(Index) and writing
+     * the running combination through Store(Index, Value).
+     */
+    template <EScanType ScanType, typename MinType, typename MaxType, typename ValueType,
+              typename CombineType, typename LoadType, typename StoreType>
+    requires (std::is_integral_v<MinType> && std::is_integral_v<MaxType>)
+    void ParallelScan(const MinType Min, const MaxType Max, const ValueType& Init, CombineType Combine,
+                      LoadType Load, StoreType Store,
+                      const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        auto OffsetLoad = [&Load, Min](const int64 Offset) -> ValueType
+        {
+            return Load(static_cast<MinType>(Min + Offset));
+        };
+
+        auto OffsetStore = [&Store, Min](const int64 Offset, const ValueType& Value)
+        {
+            Store(static_cast<MinType>(Min + Offset), Value);
+        };
+
+        Private::ParallelScanImpl<ScanType>(static_cast<int64>(Max) - static_cast<int64>(Min), Init,
+            OffsetLoad, OffsetStore, Combine, Settings);
+    }
+
+    /**
+     * Scans Input into Output, which must already hold at least as many elements as Input.
+     * Input and Output may be the same container.
+     */
+    template <EScanType ScanType, typename InputContainerType, typename OutputContainerType,
+              typename ValueType, typename CombineType>
+    requires ((THasNumConcept<InputContainerType> || THasSizeConcept<InputContainerType>)
+        && (THasNumConcept<OutputContainerType> || THasSizeConcept<OutputContainerType>))
+    void ParallelScan(const InputContainerType& Input, OutputContainerType& Output, const ValueType& Init,
+                      CombineType Combine, const FParallelForSettings& Settings = FParallelForSettings())
+    {
+        const int64 Count = static_cast<int64>(Private::GetContainerNum(Input));
+
+        solid_checkf(static_cast<int64>(Private::GetContainerNum(Output)) >= Count,
+            TEXT("ParallelScan: Output must hold at least as many elements as Input!"));
+
+        auto Load = [&Input](const int64 Index) -> ValueType
+        {
+            return Input[Index];
+        };
+
+        auto Store = [&Output](const int64 Index, const ValueType& Value)
+        {
+            Output[Index] = Value;
+        };
+
+        Private::ParallelScanImpl<ScanType>(Count, Init, Load, Store, Combine, Settings);
+    }
+
+} // namespace Solid
+
+#endif // SOLID_PARALLEL_REDUCE_H
@@ -42,6 +42,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <functional>
+#include <iterator>
 #include <limits>
 #include <memory> // only to support hash of smart pointers
 #include <stdexcept>
@@ -182,6 +183,16 @@ static Counts& counts() {
 #    define ROBIN_HOOD_UNLIKELY(condition) __builtin_expect(condition, 0)
 #endif
 
+// read prefetch hint, compiles to nothing where no intrinsic is available
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <xmmintrin.h>
+#    define ROBIN_HOOD_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<char const*>(ptr), _MM_HINT_T0)
+#elif defined(__GNUC__) || defined(__clang__)
+#    define ROBIN_HOOD_PREFETCH(ptr) __builtin_prefetch(static_cast<void const*>(ptr), 0, 3)
+#else
+#    define ROBIN_HOOD_PREFETCH(ptr)
+#endif
+
 // detect if native wchar_t type is availiable in MSVC
 #ifdef _MSC_VER
 #    ifdef _NATIVE_WCHAR_T_DEFINED
@@ -1783,6 +1794,11 @@ public:
 
     template <typename Iter>
     void insert(Iter first, Iter last) {
+        // size the table once up front instead of growing repeatedly while inserting
+        if (std::is_base_of<std::forward_iterator_tag,
+                            typename std::iterator_traits<Iter>::iterator_category>::value) {
+            reserve(mNumElements + static_cast<size_t>(std::distance(first, last)));
+        }
         for (; first != last; ++first) {
             // value_type ctor needed because this might be called with std::pair's
             insert(value_type(*first));
@@ -2228,7 +2244,14 @@ private:
         // resize operation: move stuff
         initData(numBuckets);
         if (oldMaxElementsWithBuffer > 1) {
+            // reinserting hashes each key, for node based maps that is a dependent load into the
+            // heap. Fetch the key a few live slots ahead while the current one is being moved.
+            static constexpr size_t RehashPrefetchDistance = 8;
             for (size_t i = 0; i < oldMaxElementsWithBuffer; ++i) {
+                if (i + RehashPrefetchDistance < oldMaxElementsWithBuffer &&
+                    oldInfo[i + RehashPrefetchDistance] != 0) {
+                    ROBIN_HOOD_PREFETCH(&oldKeyVals[i + RehashPrefetchDistance].getFirst());
+                }
                 if (oldInfo[i] != 0) {
                     // might throw an exception, which is really bad since we are in the middle of
                     // moving stuff.
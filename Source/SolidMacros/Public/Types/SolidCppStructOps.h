@@ -2,28 +2,114 @@
 
 #pragma once
 
-#include "CoreMinimal.h"
+#include <atomic>
 
-#include "Misc/CoreDelegates.h"
+#include "CoreMinimal.h"
 
 #include "SolidMacros.h"
 #include "SolidNotNull.h"
 #include "Concepts/SolidConcepts.h"
 
+/**
+ * Dense slot of a registered struct, look it up once with FSolidMoveableStructRegistry::FindHandle
+ * and keep it around, resolving it is a single array load. Stays valid for the lifetime of the registry.
+ */
+struct FSolidStructOpsHandle
+{
+	int32 SlotIndex = INDEX_NONE;
+
+	NO_DISCARD FORCEINLINE bool IsValid() const
+	{
+		return SlotIndex != INDEX_NONE;
+	}
+}; // struct FSolidStructOpsHandle
+
+struct FSolidMoveableStructRegistry;
+
+/**
+ * Static record created by DEFINE_SOLID_MOVEABLE_CPP_STRUCT. Records link themselves into an intrusive
+ * list at static initialization and the registry drains the whole list in one pass once UObjects exist.
+ * Records stay on the list until they are registered, so HasPending() only turns false once lookups can see them.
+ */
+struct SOLIDMACROS_API FSolidStructOpsRegistration : public FNoncopyable
+{
+	using FRegisterFunc = void(*)(FSolidMoveableStructRegistry& Registry);
+
+	explicit FSolidStructOpsRegistration(const FRegisterFunc InRegisterFunction);
+
+	NO_DISCARD FORCEINLINE static bool HasPending()
+	{
+		return PendingHead.load(std::memory_order_acquire) != nullptr;
+	}
+
+	FRegisterFunc RegisterFunction;
+	FSolidStructOpsRegistration* Next = nullptr;
+
+	static std::atomic<FSolidStructOpsRegistration*> PendingHead;
+}; // struct FSolidStructOpsRegistration
+
 struct SOLIDMACROS_API FSolidMoveableStructRegistry : public FNoncopyable
 {
 	using FMoveFunc = void(*)(void* Dest, void* Src);
 	using FCopyFunc = void(*)(void* Dest, const void* Src);
 
-	// @TODO: not used yet, but may be useful in the future
+	using FConstructFunc = void(*)(void* Dest);
+	using FDestructFunc = void(*)(void* Dest);
+
+	// Batched forms work on Count contiguous elements, Dest and Src must not overlap
+	using FMoveNFunc = void(*)(void* Dest, void* Src, uint32 Count);
+	using FCopyNFunc = void(*)(void* Dest, const void* Src, uint32 Count);
+	using FConstructNFunc = void(*)(void* Dest, uint32 Count);
+	using FDestructNFunc = void(*)(void* Dest, uint32 Count);
+
+	/**
+	 * Native ops of a registered struct, any op the type does not support is nullptr.
+	 * Relocate move constructs into uninitialized Dest and destroys Src, Swap exchanges two live values.
+	 */
 	struct FStructTypeHookInfo
 	{
 		FMoveFunc MoveConstructor = nullptr;
 		FMoveFunc MoveAssignment = nullptr;
+		FCopyFunc CopyConstructor = nullptr;
+		FCopyFunc CopyAssignment = nullptr;
+		FConstructFunc DefaultConstructor = nullptr;
+		FDestructFunc Destructor = nullptr;
+		FMoveFunc Relocate = nullptr;
+		FMoveFunc Swap = nullptr;
+
+		FMoveNFunc MoveConstructN = nullptr;
+		FMoveNFunc MoveAssignN = nullptr;
+		FCopyNFunc CopyConstructN = nullptr;
+		FCopyNFunc CopyAssignN = nullptr;
+		FConstructNFunc DefaultConstructN = nullptr;
+		FDestructNFunc DestructN = nullptr;
+		FMoveNFunc RelocateN = nullptr;
+		FMoveNFunc SwapN = nullptr;
+
+		// Guards the sparse object index lookup against a recycled UObject slot
+		const UScriptStruct* Struct = nullptr;
+
+		// sizeof the C++ type, so bulk moves never have to ask the UScriptStruct
+		int32 Size = 0;
+
+		// Moves of any kind are a plain byte copy, bulk moves become a single memcpy
+		uint8 bIsTriviallyCopyable : 1 = false;
+
+		uint8 bIsTriviallyDestructible : 1 = false;
+
+		// Default construction is all zero bytes
+		uint8 bIsZeroConstructible : 1 = false;
 	}; // struct FStructTypeHookInfo
 	
 	static FSolidMoveableStructRegistry& Get();
 
+	/**
+	 * Registers every pending DEFINE_SOLID_MOVEABLE_CPP_STRUCT record, does nothing before UObjects are initialized.
+	 * Runs at module startup, whenever a module's compiled in UObjects are registered, and on the
+	 * first lookup that finds records still pending.
+	 */
+	static void ProcessPendingRegistrations();
+
 	template <Solid::TScriptStructConcept TStructType>
 	requires (std::is_move_constructible_v<TStructType> || std::is_move_assignable_v<TStructType>)
 	void RegisterMovableScriptStruct()
@@ -31,6 +117,10 @@ struct SOLIDMACROS_API FSolidMoveableStructRegistry : public FNoncopyable
 		const TSolidNotNull<const UScriptStruct*> ScriptStruct = TBaseStructure<TStructType>::Get();
 
 		FStructTypeHookInfo TypeHookInfo;
+		TypeHookInfo.Size = sizeof(TStructType);
+		TypeHookInfo.bIsTriviallyCopyable = std::is_trivially_copyable_v<TStructType> || TIsPODType<TStructType>::Value;
+		TypeHookInfo.bIsTriviallyDestructible = std::is_trivially_destructible_v<TStructType>;
+		TypeHookInfo.bIsZeroConstructible = TIsZeroConstructType<TStructType>::Value;
 
 		constexpr bool bIsMoveConstructible = std::is_move_constructible_v<TStructType>;
 		constexpr bool bIsMoveAssignable = std::is_move_assignable_v<TStructType>;
@@ -48,10 +138,27 @@ struct SOLIDMACROS_API FSolidMoveableStructRegistry : public FNoncopyable
 			};
 
 			TypeHookInfo.MoveAssignment = MoveAssignmentFunction;
+
+			// typed stride and restrict pointers, the optimizer sees the whole loop
+			const FMoveNFunc MoveAssignNFunction = [](void* Dest, void* Src, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+				TStructType* SOLID_RESTRICT SrcStructs = static_cast<TStructType*>(Src);
+				solid_cassume(DestStructs);
+				solid_cassume(SrcStructs);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					DestStructs[Index] = MoveTemp(SrcStructs[Index]);
+				}
+			};
+
+			TypeHookInfo.MoveAssignN = MoveAssignNFunction;
 		}
 		else
 		{
 			TypeHookInfo.MoveAssignment = nullptr;
+			TypeHookInfo.MoveAssignN = nullptr;
 		}
 
 		if constexpr (bIsMoveConstructible)
@@ -66,16 +173,152 @@ struct SOLIDMACROS_API FSolidMoveableStructRegistry : public FNoncopyable
 			};
 
 			TypeHookInfo.MoveConstructor = MoveConstructorFunction;
+
+			const FMoveNFunc MoveConstructNFunction = [](void* Dest, void* Src, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+				TStructType* SOLID_RESTRICT SrcStructs = static_cast<TStructType*>(Src);
+				solid_cassume(DestStructs);
+				solid_cassume(SrcStructs);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					new (DestStructs + Index) TStructType(MoveTemp(SrcStructs[Index]));
+				}
+			};
+
+			TypeHookInfo.MoveConstructN = MoveConstructNFunction;
 		}
 		else
 		{
 			TypeHookInfo.MoveConstructor = nullptr;
+			TypeHookInfo.MoveConstructN = nullptr;
+		}
+
+		if constexpr (std::is_copy_constructible_v<TStructType>)
+		{
+			TypeHookInfo.CopyConstructor = [](void* Dest, const void* Src)
+			{
+				new (Dest) TStructType(*static_cast<const TStructType*>(Src));
+			};
+
+			TypeHookInfo.CopyConstructN = [](void* Dest, const void* Src, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+				const TStructType* SOLID_RESTRICT SrcStructs = static_cast<const TStructType*>(Src);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					new (DestStructs + Index) TStructType(SrcStructs[Index]);
+				}
+			};
+		}
+
+		if constexpr (std::is_copy_assignable_v<TStructType>)
+		{
+			TypeHookInfo.CopyAssignment = [](void* Dest, const void* Src)
+			{
+				*static_cast<TStructType*>(Dest) = *static_cast<const TStructType*>(Src);
+			};
+
+			TypeHookInfo.CopyAssignN = [](void* Dest, const void* Src, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+				const TStructType* SOLID_RESTRICT SrcStructs = static_cast<const TStructType*>(Src);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					DestStructs[Index] = SrcStructs[Index];
+				}
+			};
+		}
+
+		if constexpr (std::is_default_constructible_v<TStructType>)
+		{
+			TypeHookInfo.DefaultConstructor = [](void* Dest)
+			{
+				new (Dest) TStructType();
+			};
+
+			TypeHookInfo.DefaultConstructN = [](void* Dest, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					new (DestStructs + Index) TStructType();
+				}
+			};
+		}
+
+		if constexpr (std::is_destructible_v<TStructType>)
+		{
+			TypeHookInfo.Destructor = [](void* Dest)
+			{
+				static_cast<TStructType*>(Dest)->~TStructType();
+			};
+
+			TypeHookInfo.DestructN = [](void* Dest, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					DestStructs[Index].~TStructType();
+				}
+			};
+		}
+
+		// fused so the source is still hot in cache when it is destroyed
+		if constexpr (bIsMoveConstructible && std::is_destructible_v<TStructType>)
+		{
+			TypeHookInfo.Relocate = [](void* Dest, void* Src)
+			{
+				TStructType* SrcStruct = static_cast<TStructType*>(Src);
+
+				new (Dest) TStructType(MoveTemp(*SrcStruct));
+				SrcStruct->~TStructType();
+			};
+
+			TypeHookInfo.RelocateN = [](void* Dest, void* Src, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT DestStructs = static_cast<TStructType*>(Dest);
+				TStructType* SOLID_RESTRICT SrcStructs = static_cast<TStructType*>(Src);
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					new (DestStructs + Index) TStructType(MoveTemp(SrcStructs[Index]));
+					SrcStructs[Index].~TStructType();
+				}
+			};
+		}
+
+		if constexpr (std::is_swappable_v<TStructType>)
+		{
+			TypeHookInfo.Swap = [](void* A, void* B)
+			{
+				using std::swap;
+				swap(*static_cast<TStructType*>(A), *static_cast<TStructType*>(B));
+			};
+
+			TypeHookInfo.SwapN = [](void* A, void* B, const uint32 Count)
+			{
+				TStructType* SOLID_RESTRICT AStructs = static_cast<TStructType*>(A);
+				TStructType* SOLID_RESTRICT BStructs = static_cast<TStructType*>(B);
+
+				using std::swap;
+
+				for (uint32 Index = 0; Index < Count; ++Index)
+				{
+					swap(AStructs[Index], BStructs[Index]);
+				}
+			};
 		}
 
 		solid_cassumef(TypeHookInfo.MoveConstructor || TypeHookInfo.MoveAssignment,
 			TEXT("At least one of MoveConstructor or MoveAssignment must be valid for moveable struct registration!"));
 
-		MoveableStructs.Add(ScriptStruct, MoveTemp(TypeHookInfo));
+		AddStructTypeHookInfo(ScriptStruct, MoveTemp(TypeHookInfo));
 	}
 
 	template <Solid::TScriptStructConcept TStructType>
@@ -98,58 +341,295 @@ struct SOLIDMACROS_API FSolidMoveableStructRegistry : public FNoncopyable
 	
 	NO_DISCARD const FStructTypeHookInfo& GetStructTypeHookInfo(const TSolidNotNull<const UScriptStruct*> InStruct) const;
 
+	// nullptr when InStruct is not registered
+	NO_DISCARD FORCEINLINE const FStructTypeHookInfo* FindStructTypeHookInfo(const TSolidNotNull<const UScriptStruct*> InStruct) const
+	{
+		const FSolidStructOpsHandle Handle = FindHandle(InStruct);
+		return Handle.IsValid() ? &GetStructTypeHookInfo(Handle) : nullptr;
+	}
+
+	// Invalid when InStruct is not registered, safe to call from any thread while structs are being registered
+	NO_DISCARD FORCEINLINE FSolidStructOpsHandle FindHandle(const TSolidNotNull<const UScriptStruct*> InStruct) const
+	{
+		// blocks until a registration pass in progress on another thread has published its structs
+		if UNLIKELY_IF(FSolidStructOpsRegistration::HasPending())
+		{
+			ProcessPendingRegistrations();
+		}
+
+		const uint32 ObjectIndex = InStruct->GetUniqueID();
+		const uint32 ChunkIndex = ObjectIndex >> SlotIndexChunkShift;
+
+		if (ChunkIndex < MaxSlotIndexChunks)
+		{
+			if (const std::atomic<int32>* Chunk = SlotIndexChunks[ChunkIndex].load(std::memory_order_acquire))
+			{
+				const int32 SlotIndex = Chunk[ObjectIndex & (SlotIndexChunkSize - 1)].load(std::memory_order_acquire);
+
+				if (SlotIndex != INDEX_NONE && GetStructTypeHookInfo(FSolidStructOpsHandle { SlotIndex }).Struct == InStruct.Get())
+				{
+					return FSolidStructOpsHandle { SlotIndex };
+				}
+			}
+		}
+
+		return FSolidStructOpsHandle();
+	}
+
+	// The reference stays valid for the lifetime of the registry, later registrations never move it
+	NO_DISCARD FORCEINLINE const FStructTypeHookInfo& GetStructTypeHookInfo(const FSolidStructOpsHandle Handle) const
+	{
+		solid_checkf(Handle.SlotIndex >= 0 && Handle.SlotIndex < MaxHookInfoChunks * HookInfoChunkSize,
+			TEXT("Invalid FSolidStructOpsHandle!"));
+
+		const FStructTypeHookInfo* Chunk = HookInfoChunks[Handle.SlotIndex >> HookInfoChunkShift].load(std::memory_order_acquire);
+		solid_checkf(Chunk, TEXT("Invalid FSolidStructOpsHandle!"));
+
+		return Chunk[Handle.SlotIndex & (HookInfoChunkSize - 1)];
+	}
+
 private:
-	TMap<TObjectPtr<const UScriptStruct>, FStructTypeHookInfo> MoveableStructs;
+	void AddStructTypeHookInfo(const TSolidNotNull<const UScriptStruct*> InStruct, FStructTypeHookInfo&& TypeHookInfo);
+
+	static constexpr int32 HookInfoChunkShift = 8;
+	static constexpr int32 HookInfoChunkSize = 1 << HookInfoChunkShift;
+	static constexpr int32 MaxHookInfoChunks = 256;
+
+	static constexpr int32 SlotIndexChunkShift = 14;
+	static constexpr int32 SlotIndexChunkSize = 1 << SlotIndexChunkShift;
+	static constexpr uint32 MaxSlotIndexChunks = 1024;
+
+	// Serializes writers, readers never take it
+	FCriticalSection CriticalSection;
+
+	// Dense, one entry per registered struct. Chunks are never reallocated or freed, so lock free readers
+	// and references already handed out stay valid while later modules register their structs.
+	std::atomic<FStructTypeHookInfo*> HookInfoChunks[MaxHookInfoChunks] = {};
+	int32 NumStructTypeHookInfos = 0;
+
+	// Sparse, indexed by UObject::GetUniqueID() which is the struct's slot in GUObjectArray.
+	// A slot index is only published once its hook info is fully written.
+	std::atomic<std::atomic<int32>*> SlotIndexChunks[MaxSlotIndexChunks] = {};
 	
 }; // struct FSolidMoveableStructRegistry
 
 namespace Solid
 {
-	// @TODO: add a restrict keyword to this?
-	inline void MoveConstructScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, void* Src,
-	                             const uint32 Count = 1)
+	namespace Private
 	{
-		solid_checkf(IsValid(InStruct), TEXT("InStruct must be valid!"));
-			
-		solid_cassume(Dest);
-		solid_cassume(Src);
+		NO_DISCARD FORCEINLINE const FSolidMoveableStructRegistry::FStructTypeHookInfo& FindStructTypeHookInfoChecked(
+			const TSolidNotNull<const UScriptStruct*> InStruct)
+		{
+			solid_checkf(IsValid(InStruct), TEXT("InStruct must be valid!"));
 
-		solid_checkf(FSolidMoveableStructRegistry::Get().IsStructMovable(InStruct),
-					 TEXT("InStruct is not registered as moveable!"));
-			
-		const FSolidMoveableStructRegistry::FMoveFunc MoveFunction =
-			FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(InStruct).MoveConstructor;
-				
-		for (uint32 Index = 0; Index < Count; ++Index)
+			const FSolidMoveableStructRegistry::FStructTypeHookInfo* TypeHookInfo =
+				FSolidMoveableStructRegistry::Get().FindStructTypeHookInfo(InStruct);
+
+			solid_checkf(TypeHookInfo, TEXT("InStruct is not registered as moveable!"));
+			return *TypeHookInfo;
+		}
+
+		FORCEINLINE void MoveConstructScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                           void* Dest, void* Src, const uint32 Count)
+		{
+			solid_cassume(Dest);
+			solid_cassume(Src);
+
+			if (TypeHookInfo.bIsTriviallyCopyable)
+			{
+				FMemory::Memcpy(Dest, Src, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.MoveConstructN, TEXT("Struct is not move constructible!"));
+
+			// one indirect call per batch
+			TypeHookInfo.MoveConstructN(Dest, Src, Count);
+		}
+
+		FORCEINLINE void MoveAssignScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                        void* Dest, void* Src, const uint32 Count)
 		{
-			MoveFunction(
-				reinterpret_cast<uint8*>(Dest) + Index * InStruct->GetStructureSize(),
-				reinterpret_cast<uint8*>(Src) + Index * InStruct->GetStructureSize()
-				);
+			solid_cassume(Dest);
+			solid_cassume(Src);
+
+			if (TypeHookInfo.bIsTriviallyCopyable)
+			{
+				FMemory::Memcpy(Dest, Src, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.MoveAssignN, TEXT("Struct is not move assignable!"));
+			TypeHookInfo.MoveAssignN(Dest, Src, Count);
 		}
+
+		FORCEINLINE void CopyConstructScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                           void* Dest, const void* Src, const uint32 Count)
+		{
+			if (TypeHookInfo.bIsTriviallyCopyable)
+			{
+				FMemory::Memcpy(Dest, Src, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.CopyConstructN, TEXT("Struct is not copy constructible!"));
+			TypeHookInfo.CopyConstructN(Dest, Src, Count);
+		}
+
+		FORCEINLINE void CopyAssignScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                        void* Dest, const void* Src, const uint32 Count)
+		{
+			if (TypeHookInfo.bIsTriviallyCopyable)
+			{
+				FMemory::Memcpy(Dest, Src, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.CopyAssignN, TEXT("Struct is not copy assignable!"));
+			TypeHookInfo.CopyAssignN(Dest, Src, Count);
+		}
+
+		FORCEINLINE void DefaultConstructScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                              void* Dest, const uint32 Count)
+		{
+			if (TypeHookInfo.bIsZeroConstructible)
+			{
+				FMemory::Memzero(Dest, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.DefaultConstructN, TEXT("Struct is not default constructible!"));
+			TypeHookInfo.DefaultConstructN(Dest, Count);
+		}
+
+		FORCEINLINE void DestroyScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                     void* Dest, const uint32 Count)
+		{
+			if (TypeHookInfo.bIsTriviallyDestructible)
+			{
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.DestructN, TEXT("Struct is not destructible!"));
+			TypeHookInfo.DestructN(Dest, Count);
+		}
+
+		FORCEINLINE void RelocateScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                      void* Dest, void* Src, const uint32 Count)
+		{
+			if (TypeHookInfo.bIsTriviallyCopyable)
+			{
+				FMemory::Memcpy(Dest, Src, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.RelocateN, TEXT("Struct is not relocatable!"));
+			TypeHookInfo.RelocateN(Dest, Src, Count);
+		}
+
+		FORCEINLINE void SwapScriptStruct(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+		                                  void* A, void* B, const uint32 Count)
+		{
+			if (TypeHookInfo.bIsTriviallyCopyable)
+			{
+				FMemory::Memswap(A, B, Count * static_cast<SIZE_T>(TypeHookInfo.Size));
+				return;
+			}
+
+			solid_checkf(TypeHookInfo.SwapN, TEXT("Struct is not swappable!"));
+			TypeHookInfo.SwapN(A, B, Count);
+		}
+
+	} // namespace Private
+
+	// @TODO: add a restrict keyword to this?
+	inline void MoveConstructScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, void* Src,
+	                             const uint32 Count = 1)
+	{
+		Private::MoveConstructScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Src, Count);
 	}
 
 	inline void MoveAssignScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, void* Src,
 	                            const uint32 Count = 1)
 	{
-		solid_checkf(IsValid(InStruct), TEXT("InStruct must be valid!"));
-		
-		solid_cassume(Dest);
-		solid_cassume(Src);
+		Private::MoveAssignScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Src, Count);
+	}
 
-		solid_checkf(FSolidMoveableStructRegistry::Get().IsStructMovable(InStruct),
-					 TEXT("InStruct is not registered as moveable!"));
-		
-		const FSolidMoveableStructRegistry::FMoveFunc MoveFunction =
-			FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(InStruct).MoveAssignment;
-			
-		for (uint32 Index = 0; Index < Count; ++Index)
-		{
-			MoveFunction(
-				reinterpret_cast<uint8*>(Dest) + Index * InStruct->GetStructureSize(),
-				reinterpret_cast<uint8*>(Src) + Index * InStruct->GetStructureSize()
-				);
-		}
+	// Handle variants skip the lookup entirely, for callers moving the same type over and over
+	FORCEINLINE void MoveConstructScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, void* Src, const uint32 Count = 1)
+	{
+		Private::MoveConstructScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Src, Count);
+	}
+
+	FORCEINLINE void MoveAssignScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, void* Src, const uint32 Count = 1)
+	{
+		Private::MoveAssignScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Src, Count);
+	}
+
+	// Copy constructs Count elements into uninitialized Dest
+	inline void CopyConstructScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, const void* Src,
+	                                      const uint32 Count = 1)
+	{
+		Private::CopyConstructScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Src, Count);
+	}
+
+	FORCEINLINE void CopyConstructScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, const void* Src, const uint32 Count = 1)
+	{
+		Private::CopyConstructScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Src, Count);
+	}
+
+	inline void CopyAssignScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, const void* Src,
+	                                   const uint32 Count = 1)
+	{
+		Private::CopyAssignScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Src, Count);
+	}
+
+	FORCEINLINE void CopyAssignScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, const void* Src, const uint32 Count = 1)
+	{
+		Private::CopyAssignScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Src, Count);
+	}
+
+	// Default constructs Count elements into uninitialized Dest
+	inline void DefaultConstructScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, const uint32 Count = 1)
+	{
+		Private::DefaultConstructScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Count);
+	}
+
+	FORCEINLINE void DefaultConstructScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, const uint32 Count = 1)
+	{
+		Private::DefaultConstructScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Count);
+	}
+
+	inline void DestroyScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, const uint32 Count = 1)
+	{
+		Private::DestroyScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Count);
+	}
+
+	FORCEINLINE void DestroyScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, const uint32 Count = 1)
+	{
+		Private::DestroyScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Count);
+	}
+
+	// Move constructs Count elements into uninitialized Dest and destroys them in Src
+	inline void RelocateScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, void* Src,
+	                                 const uint32 Count = 1)
+	{
+		Private::RelocateScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), Dest, Src, Count);
+	}
+
+	FORCEINLINE void RelocateScriptStruct(const FSolidStructOpsHandle Handle, void* Dest, void* Src, const uint32 Count = 1)
+	{
+		Private::RelocateScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), Dest, Src, Count);
+	}
+
+	inline void SwapScriptStruct(const TSolidNotNull<const UScriptStruct*> InStruct, void* A, void* B, const uint32 Count = 1)
+	{
+		Private::SwapScriptStruct(Private::FindStructTypeHookInfoChecked(InStruct), A, B, Count);
+	}
+
+	FORCEINLINE void SwapScriptStruct(const FSolidStructOpsHandle Handle, void* A, void* B, const uint32 Count = 1)
+	{
+		Private::SwapScriptStruct(FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle), A, B, Count);
 	}
 
 } // namespace Solid
@@ -159,19 +639,13 @@ namespace Solid
 #define DEFINE_SOLID_MOVEABLE_CPP_STRUCT(StructType) \
 	namespace \
 	{ \
-		struct FSolidOpsAutoReg_##StructType \
-		{ \
-			FSolidOpsAutoReg_##StructType() \
+		static FSolidStructOpsRegistration GSolidStructOpsRegistration_##StructType( \
+			[](FSolidMoveableStructRegistry& Registry) \
 			{ \
-				FCoreDelegates::GetOnPostEngineInit().AddLambda([]() \
-				{ \
-					static_assert(Solid::TStaticStructConcept<StructType>, "StructType must be a USTRUCT"); \
-					 \
-					FSolidMoveableStructRegistry::Get().RegisterMovableScriptStruct<StructType>(); \
-				}); \
-			} \
-		}; \
-		static FSolidOpsAutoReg_##StructType GAutoReg_SolidOps_##StructType;     \
+				static_assert(Solid::TStaticStructConcept<StructType>, "StructType must be a USTRUCT"); \
+				 \
+				Registry.RegisterMovableScriptStruct<StructType>(); \
+			}); \
 	} // namespace
 
 #endif // DEFINE_SOLID_MOVEABLE_CPP_STRUCT
\ No newline at end of file
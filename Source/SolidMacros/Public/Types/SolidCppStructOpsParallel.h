@@ -0,0 +1,55 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+#include "Standard/ParallelFor.h"
+#include "Types/SolidCppStructOps.h"
+
+namespace Solid
+{
+	namespace Private
+	{
+		/**
+		 * Always splits the batch across workers, whatever its size. Chunks cover a whole number of
+		 * cache lines, so with a cache line aligned Dest no two workers ever write to the same line.
+		 */
+		SOLIDMACROS_API void MoveConstructScriptStructChunked(const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo,
+			void* Dest, void* Src, const uint32 Count, const FParallelForSettings& Settings);
+
+		// Solid.StructOps.ParallelMoveThreshold, in bytes
+		NO_DISCARD SOLIDMACROS_API SIZE_T GetParallelStructMoveThresholdBytes();
+
+	} // namespace Private
+
+	/**
+	 * MoveConstructScriptStruct split across workers for batches of at least Solid.StructOps.ParallelMoveThreshold
+	 * bytes, smaller ones run inline. Solid.Benchmarks.StructMoveParallel measures the crossover.
+	 */
+	inline void MoveConstructScriptStructParallel(const FSolidStructOpsHandle Handle, void* Dest, void* Src, const uint32 Count,
+	                                              const FParallelForSettings& Settings = FParallelForSettings())
+	{
+		const FSolidMoveableStructRegistry::FStructTypeHookInfo& TypeHookInfo =
+			FSolidMoveableStructRegistry::Get().GetStructTypeHookInfo(Handle);
+
+		if (Count * static_cast<SIZE_T>(TypeHookInfo.Size) < Private::GetParallelStructMoveThresholdBytes())
+		{
+			Private::MoveConstructScriptStruct(TypeHookInfo, Dest, Src, Count);
+			return;
+		}
+
+		Private::MoveConstructScriptStructChunked(TypeHookInfo, Dest, Src, Count, Settings);
+	}
+
+	inline void MoveConstructScriptStructParallel(const TSolidNotNull<const UScriptStruct*> InStruct, void* Dest, void* Src,
+	                                              const uint32 Count, const FParallelForSettings& Settings = FParallelForSettings())
+	{
+		const FSolidStructOpsHandle Handle = FSolidMoveableStructRegistry::Get().FindHandle(InStruct);
+		solid_checkf(Handle.IsValid(), TEXT("InStruct is not registered as moveable!"));
+
+		MoveConstructScriptStructParallel(Handle, Dest, Src, Count, Settings);
+	}
+
+} // namespace Solid
@@ -0,0 +1,76 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "StructUtils/InstancedStruct.h"
+
+#include "SolidMacros/Macros.h"
+#include "Types/SolidCppStructOps.h"
+
+namespace Solid
+{
+	/**
+	 * Moves Source's value into Dest and always leaves Source empty.
+	 * When both hold the same registered type, the value is move assigned into Dest's existing payload,
+	 * otherwise Dest adopts Source's allocation. Solid.Benchmarks.InstancedStructMove compares the two.
+	 */
+	inline void MoveInstancedStruct(FInstancedStruct& Dest, FInstancedStruct& Source)
+	{
+		if UNLIKELY_IF(&Dest == &Source)
+		{
+			return;
+		}
+
+		const UScriptStruct* Struct = Source.GetScriptStruct();
+
+		if (Struct && Struct == Dest.GetScriptStruct())
+		{
+			const FSolidMoveableStructRegistry::FStructTypeHookInfo* TypeHookInfo =
+				FSolidMoveableStructRegistry::Get().FindStructTypeHookInfo(Struct);
+
+			if (TypeHookInfo && (TypeHookInfo->bIsTriviallyCopyable || TypeHookInfo->MoveAssignN))
+			{
+				Private::MoveAssignScriptStruct(*TypeHookInfo, Dest.GetMutableMemory(), Source.GetMutableMemory(), 1);
+
+				// destroys the moved-from value and frees Source's allocation
+				Source.Reset();
+				return;
+			}
+		}
+
+		// FInstancedStruct's move steals the pointer and resets Source
+		Dest = MoveTemp(Source);
+	}
+
+	/**
+	 * Moves Source's value into uninitialized DestMemory, which must be sized and aligned for
+	 * Source's type, and leaves Source empty. Registered types move through the registry,
+	 * anything else falls back to reflection copy.
+	 */
+	inline void RelocateInstancedStruct(void* DestMemory, FInstancedStruct& Source)
+	{
+		solid_cassume(DestMemory);
+
+		const UScriptStruct* Struct = Source.GetScriptStruct();
+		solid_checkf(Struct, TEXT("RelocateInstancedStruct needs a valid Source!"));
+
+		const FSolidMoveableStructRegistry::FStructTypeHookInfo* TypeHookInfo =
+			FSolidMoveableStructRegistry::Get().FindStructTypeHookInfo(Struct);
+
+		if (TypeHookInfo && (TypeHookInfo->bIsTriviallyCopyable || TypeHookInfo->MoveConstructN))
+		{
+			Private::MoveConstructScriptStruct(*TypeHookInfo, DestMemory, Source.GetMutableMemory(), 1);
+		}
+		else
+		{
+			Struct->InitializeStruct(DestMemory);
+			Struct->CopyScriptStruct(DestMemory, Source.GetMemory());
+		}
+
+		// destroys the moved-from value and frees Source's allocation
+		Source.Reset();
+	}
+
+} // namespace Solid
@@ -0,0 +1,200 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "StructUtils/StructView.h"
+
+#include "SolidMacros/Macros.h"
+#include "Types/SolidCppStructOps.h"
+
+/**
+ * Contiguous array of a struct type chosen at runtime, one aligned allocation for every element
+ * instead of one per element like TArray<FInstancedStruct>. The struct must be registered with
+ * DEFINE_SOLID_MOVEABLE_CPP_STRUCT, every element operation goes through the registry's batched kernels.
+ * The array is invisible to reflection, owners of elements holding UObject references must call
+ * AddReferencedObjects from their own AddReferencedObjects or FGCObject for those references to be kept alive.
+ */
+struct SOLIDMACROS_API FSolidStructArray
+{
+	template <typename ViewType, typename ByteType>
+	struct TIterator
+	{
+		FORCEINLINE TIterator(const UScriptStruct* InStruct, ByteType* InElement, const int32 InStride)
+			: Struct(InStruct)
+			, Element(InElement)
+			, Stride(InStride)
+		{
+		}
+
+		NO_DISCARD FORCEINLINE ViewType operator*() const
+		{
+			return ViewType(Struct, Element);
+		}
+
+		FORCEINLINE TIterator& operator++()
+		{
+			Element += Stride;
+			return *this;
+		}
+
+		NO_DISCARD FORCEINLINE bool operator!=(const TIterator& Other) const
+		{
+			return Element != Other.Element;
+		}
+
+	private:
+		const UScriptStruct* Struct;
+		ByteType* Element;
+		int32 Stride;
+	}; // struct TIterator
+
+	using FIterator = TIterator<FStructView, uint8>;
+	using FConstIterator = TIterator<FConstStructView, const uint8>;
+
+	FSolidStructArray() = default;
+	explicit FSolidStructArray(const TSolidNotNull<const UScriptStruct*> InStruct);
+
+	FSolidStructArray(const FSolidStructArray& Other);
+	FSolidStructArray(FSolidStructArray&& Other) noexcept;
+
+	FSolidStructArray& operator=(const FSolidStructArray& Other);
+	FSolidStructArray& operator=(FSolidStructArray&& Other) noexcept;
+
+	~FSolidStructArray();
+
+	NO_DISCARD FORCEINLINE const UScriptStruct* GetScriptStruct() const
+	{
+		return Struct;
+	}
+
+	NO_DISCARD FORCEINLINE int32 Num() const
+	{
+		return ArrayNum;
+	}
+
+	NO_DISCARD FORCEINLINE int32 Max() const
+	{
+		return ArrayMax;
+	}
+
+	NO_DISCARD FORCEINLINE bool IsEmpty() const
+	{
+		return ArrayNum == 0;
+	}
+
+	NO_DISCARD FORCEINLINE bool IsValidIndex(const int32 Index) const
+	{
+		return Index >= 0 && Index < ArrayNum;
+	}
+
+	// Bytes between two consecutive elements
+	NO_DISCARD FORCEINLINE int32 GetStride() const
+	{
+		return Stride;
+	}
+
+	NO_DISCARD FORCEINLINE uint8* GetData()
+	{
+		return Data;
+	}
+
+	NO_DISCARD FORCEINLINE const uint8* GetData() const
+	{
+		return Data;
+	}
+
+	NO_DISCARD FORCEINLINE FStructView operator[](const int32 Index)
+	{
+		solid_checkf(IsValidIndex(Index), TEXT("FSolidStructArray index %d out of bounds, Num is %d"), Index, ArrayNum);
+		return FStructView(Struct, Data + static_cast<SIZE_T>(Index) * Stride);
+	}
+
+	NO_DISCARD FORCEINLINE FConstStructView operator[](const int32 Index) const
+	{
+		solid_checkf(IsValidIndex(Index), TEXT("FSolidStructArray index %d out of bounds, Num is %d"), Index, ArrayNum);
+		return FConstStructView(Struct, Data + static_cast<SIZE_T>(Index) * Stride);
+	}
+
+	template <typename T>
+	NO_DISCARD FORCEINLINE T& Get(const int32 Index)
+	{
+		solid_checkf(TBaseStructure<T>::Get() == Struct, TEXT("FSolidStructArray accessed with the wrong struct type!"));
+		solid_checkf(IsValidIndex(Index), TEXT("FSolidStructArray index %d out of bounds, Num is %d"), Index, ArrayNum);
+		return reinterpret_cast<T*>(Data)[Index];
+	}
+
+	template <typename T>
+	NO_DISCARD FORCEINLINE const T& Get(const int32 Index) const
+	{
+		return const_cast<FSolidStructArray*>(this)->Get<T>(Index);
+	}
+
+	void Reserve(const int32 Number);
+
+	// Appends Count default constructed elements, returns the index of the first one
+	int32 AddDefaulted(const int32 Count = 1);
+
+	// Appends a copy of Value, which must be of this array's struct type
+	int32 Add(const FConstStructView Value);
+
+	template <typename T, typename... ArgTypes>
+	int32 Emplace(ArgTypes&&... Args)
+	{
+		solid_checkf(TBaseStructure<T>::Get() == Struct, TEXT("FSolidStructArray emplaced with the wrong struct type!"));
+
+		const int32 Index = AddUninitialized(1);
+		new (Data + static_cast<SIZE_T>(Index) * Stride) T(Forward<ArgTypes>(Args)...);
+
+		return Index;
+	}
+
+	// Destroys the element and relocates the last one into its slot, does not preserve order
+	void RemoveAtSwap(const int32 Index);
+
+	// Destroys every element, keeps the allocation
+	void Reset();
+
+	// Destroys every element and frees the allocation
+	void Empty();
+
+	// Reports the UObject references held by every element to Collector
+	void AddReferencedObjects(FReferenceCollector& Collector);
+
+	NO_DISCARD FORCEINLINE FIterator begin()
+	{
+		return FIterator(Struct, Data, Stride);
+	}
+
+	NO_DISCARD FORCEINLINE FIterator end()
+	{
+		return FIterator(Struct, Data + static_cast<SIZE_T>(ArrayNum) * Stride, Stride);
+	}
+
+	NO_DISCARD FORCEINLINE FConstIterator begin() const
+	{
+		return FConstIterator(Struct, Data, Stride);
+	}
+
+	NO_DISCARD FORCEINLINE FConstIterator end() const
+	{
+		return FConstIterator(Struct, Data + static_cast<SIZE_T>(ArrayNum) * Stride, Stride);
+	}
+
+private:
+	// Grows if needed and bumps Num, the new elements are left uninitialized
+	int32 AddUninitialized(const int32 Count);
+
+	void ResizeAllocation(const int32 NewMax);
+
+	const UScriptStruct* Struct = nullptr;
+	FSolidStructOpsHandle Handle;
+
+	uint8* Data = nullptr;
+	int32 ArrayNum = 0;
+	int32 ArrayMax = 0;
+
+	int32 Stride = 0;
+	int32 Alignment = 0;
+}; // struct FSolidStructArray
@@ -0,0 +1,147 @@
+﻿// Elie Wiese-Namir © 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SolidMacros/Macros.h"
+#include "Types/SolidCppStructOps.h"
+
+namespace Solid
+{
+	namespace StructPool::Private
+	{
+		struct FFreeBlock;
+		struct FThreadCache;
+
+		void Startup();
+		void Shutdown();
+
+	} // namespace StructPool::Private
+
+	struct FStructPoolStats
+	{
+		int32 NumSlabs = 0;
+		int32 NumFreeBlocks = 0;
+		int64 ReservedBytes = 0;
+		int64 NumRefills = 0;
+	}; // struct FStructPoolStats
+
+	/**
+	 * Fixed size blocks for one struct type, carved out of slabs aligned to the struct's GetMinAlignment.
+	 * Each thread keeps a small free list per pool, so most allocations and frees never take the lock,
+	 * the shared free list is only touched in batches. Slabs whose blocks are all back in the shared
+	 * free list are released by Trim.
+	 */
+	class SOLIDMACROS_API FStructPool
+	{
+	public:
+		FStructPool(const TSolidNotNull<const UScriptStruct*> InStruct, const int32 InIndex);
+
+		UE_NONCOPYABLE(FStructPool);
+
+		NO_DISCARD FORCEINLINE const UScriptStruct* GetScriptStruct() const
+		{
+			return Struct;
+		}
+
+		NO_DISCARD FORCEINLINE int32 GetBlockSize() const
+		{
+			return BlockSize;
+		}
+
+		NO_DISCARD FORCEINLINE int32 GetAlignment() const
+		{
+			return Alignment;
+		}
+
+		// Uninitialized block
+		NO_DISCARD void* Allocate();
+		void Free(void* Block);
+
+		// Default constructed through the registry when the struct is registered, reflection otherwise
+		NO_DISCARD void* New();
+
+		// Move constructs from Src, which is left in its moved-from state
+		NO_DISCARD void* MoveNew(void* Src);
+
+		void Delete(void* Block);
+
+		// Returns the calling thread's cached blocks to the shared free list
+		void FlushThreadCache();
+
+		// Frees every slab with no live block, returns the number of bytes released
+		int64 Trim();
+
+		NO_DISCARD FStructPoolStats GetStats() const;
+
+	private:
+		friend struct StructPool::Private::FThreadCache;
+
+		void Refill(StructPool::Private::FThreadCache& Cache);
+		void ReturnBlocks(StructPool::Private::FFreeBlock* Head, StructPool::Private::FFreeBlock* Tail, const int32 Count);
+		void AllocateSlab();
+
+		NO_DISCARD StructPool::Private::FThreadCache& GetThreadCache();
+
+		const UScriptStruct* Struct;
+		FSolidStructOpsHandle Handle;
+
+		// Slot in every thread's cache array
+		int32 Index;
+
+		int32 BlockSize;
+		int32 Alignment;
+		int32 BlocksPerSlab;
+
+		// Blocks moved between a thread cache and the shared free list at once
+		int32 BatchSize;
+
+		mutable FCriticalSection CriticalSection;
+		StructPool::Private::FFreeBlock* FreeList = nullptr;
+		int32 NumFreeBlocks = 0;
+		int64 NumRefills = 0;
+
+		// Sorted by address so Trim can map a free block to its slab
+		TArray<uint8*> Slabs;
+	}; // class FStructPool
+
+	/**
+	 * One FStructPool per struct type, for payloads of the same few structs that are created and
+	 * destroyed far too often to pay for a malloc each. Pools live for the whole process.
+	 * Hot callers should hold on to the FStructPool instead of looking it up every time.
+	 *
+	 *	Solid::FStructPool& Pool = Solid::FStructPoolAllocator::Get().GetPool(FMyStruct::StaticStruct());
+	 *	void* Payload = Pool.New();
+	 *	Pool.Delete(Payload);
+	 */
+	class SOLIDMACROS_API FStructPoolAllocator
+	{
+	public:
+		static FStructPoolAllocator& Get();
+
+		NO_DISCARD FStructPool& GetPool(const TSolidNotNull<const UScriptStruct*> InStruct);
+
+		NO_DISCARD FORCEINLINE void* New(const TSolidNotNull<const UScriptStruct*> InStruct)
+		{
+			return GetPool(InStruct).New();
+		}
+
+		FORCEINLINE void Delete(const TSolidNotNull<const UScriptStruct*> InStruct, void* Block)
+		{
+			GetPool(InStruct).Delete(Block);
+		}
+
+		// Trims every pool, returns the number of bytes released
+		int64 Trim();
+
+		// Logs hit rate and memory of every pool
+		void Dump() const;
+
+	private:
+		mutable FRWLock Lock;
+		TMap<const UScriptStruct*, FStructPool*> PoolsByStruct;
+		TArray<FStructPool*> Pools;
+	}; // class FStructPoolAllocator
+
+} // namespace Solid
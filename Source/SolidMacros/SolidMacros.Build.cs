@@ -33,6 +33,7 @@ public class SolidMacros : ModuleRules
 			new string[]
 			{
 				"EngineSettings",
+				"Json",
 			}
 			);
 		
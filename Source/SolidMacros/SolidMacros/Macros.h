@@ -15,6 +15,7 @@
 
 #include "Misc/AssertionMacros.h"
 #include "GenericPlatform/GenericPlatformTime.h"
+#include "Misc/StringBuilder.h"
 
 namespace Solid
 {
@@ -100,19 +101,147 @@ namespace Solid
 
 	namespace internal
 	{
-		template <typename... T>
-		FORCEINLINE const TCHAR* BuildCheckTextFormat(const TCHAR* Format, T&&... Args)
+		// Not constexpr on purpose, reaching it during constant evaluation turns a bad format into a compile error
+		inline void CheckFormatArgumentIndexOutOfRange()
 		{
-			FStringFormatOrderedArguments OrderedArgs;
-			OrderedArgs.Reserve(sizeof...(T));
-			
-			(OrderedArgs.Emplace(Forward<T>(Args)), ...);
-			
-			FString Buffer;
-			Buffer = FString::Format(Format, OrderedArgs);
-
-			return *Buffer;
 		}
+
+		/**
+		 * Format string for the solid_*fmt macros, using the ordered {0}, {1} placeholders of FString::Format.
+		 * Placeholders are validated against the argument count at compile time.
+		 */
+		template <int32 NumArgs>
+		struct TCheckFormatString
+		{
+			template <int32 N>
+			consteval TCheckFormatString(const TCHAR (&InFormat)[N])
+				: Format(InFormat)
+				, Length(N - 1)
+			{
+				for (int32 Index = 0; Index < Length; ++Index)
+				{
+					if (InFormat[Index] != TEXT('{'))
+					{
+						continue;
+					}
+
+					int32 End = Index + 1;
+					int32 ArgIndex = 0;
+
+					while (End < Length && InFormat[End] >= TEXT('0') && InFormat[End] <= TEXT('9'))
+					{
+						ArgIndex = ArgIndex * 10 + static_cast<int32>(InFormat[End] - TEXT('0'));
+						++End;
+					}
+
+					if (End > Index + 1 && End < Length && InFormat[End] == TEXT('}'))
+					{
+						if (ArgIndex >= NumArgs)
+						{
+							CheckFormatArgumentIndexOutOfRange();
+						}
+
+						Index = End;
+					}
+				}
+			}
+
+			const TCHAR* Format;
+			int32 Length;
+		}; // struct TCheckFormatString
+
+		template <typename T>
+		FORCEINLINE void AppendCheckFormatArg(FStringBuilderBase& Builder, const T& Arg)
+		{
+			using FArgType = std::decay_t<T>;
+
+			if constexpr (std::is_same_v<FArgType, bool>)
+			{
+				Builder << (Arg ? TEXT("true") : TEXT("false"));
+			}
+			else if constexpr (std::is_floating_point_v<FArgType>)
+			{
+				Builder.Appendf(TEXT("%f"), static_cast<double>(Arg));
+			}
+			else if constexpr (std::is_integral_v<FArgType> && std::is_signed_v<FArgType>)
+			{
+				Builder.Appendf(TEXT("%lld"), static_cast<long long>(Arg));
+			}
+			else if constexpr (std::is_integral_v<FArgType>)
+			{
+				Builder.Appendf(TEXT("%llu"), static_cast<unsigned long long>(Arg));
+			}
+			else if constexpr (std::is_enum_v<FArgType>)
+			{
+				Builder.Appendf(TEXT("%lld"), static_cast<long long>(Arg));
+			}
+			else if constexpr (std::is_convertible_v<const T&, FStringView>)
+			{
+				Builder << FStringView(Arg);
+			}
+			else if constexpr (std::is_same_v<FArgType, FName>)
+			{
+				Arg.AppendString(Builder);
+			}
+			else if constexpr (std::is_same_v<FArgType, FText>)
+			{
+				Builder << Arg.ToString();
+			}
+			else
+			{
+				Builder << LexToString(Arg);
+			}
+		}
+
+		/**
+		 * Formats into a stack buffer when constructed. The solid_*fmt macros only construct it inside
+		 * the failure branch, so a passing check never formats or allocates. Dereferencing yields a string
+		 * that lives until the end of the full expression the temporary was created in.
+		 */
+		class FCheckText
+		{
+		public:
+			template <typename... ArgTypes>
+			FORCENOINLINE FCheckText(const TCheckFormatString<sizeof...(ArgTypes)> Format, const ArgTypes&... Args)
+			{
+				for (int32 Index = 0; Index < Format.Length; ++Index)
+				{
+					const TCHAR Character = Format.Format[Index];
+
+					if (Character == TEXT('{'))
+					{
+						int32 End = Index + 1;
+						int32 ArgIndex = 0;
+
+						while (End < Format.Length && FChar::IsDigit(Format.Format[End]))
+						{
+							ArgIndex = ArgIndex * 10 + static_cast<int32>(Format.Format[End] - TEXT('0'));
+							++End;
+						}
+
+						if (End > Index + 1 && End < Format.Length && Format.Format[End] == TEXT('}'))
+						{
+							int32 CurrentArg = 0;
+							((CurrentArg++ == ArgIndex ? AppendCheckFormatArg(Builder, Args) : void()), ...);
+
+							Index = End;
+							continue;
+						}
+					}
+
+					Builder.AppendChar(Character);
+				}
+			}
+
+			NO_DISCARD FORCEINLINE const TCHAR* operator*() const
+			{
+				return *Builder;
+			}
+
+		private:
+			TStringBuilder<512> Builder;
+
+		}; // class FCheckText
 		
 	} // namespace internal
 	
@@ -254,6 +383,21 @@ namespace Solid
 
 #endif // FORCEINLINE_ATTRIBUTE
 
+// Counts how often each hinted branch actually goes each way, see Solid.BranchHints.Dump.
+// Conditions that declare a variable cannot be wrapped and fail to compile in this mode.
+#ifndef SOLID_PROFILE_BRANCH_HINTS
+#define SOLID_PROFILE_BRANCH_HINTS 0
+#endif // SOLID_PROFILE_BRANCH_HINTS
+
+#if SOLID_PROFILE_BRANCH_HINTS
+
+#include "Diagnostics/SolidBranchHintProfiler.h"
+
+#define LIKELY_IF(x) (SOLID_BRANCH_HINT_RECORD(x, true)) [[likely]]
+#define UNLIKELY_IF(x) (SOLID_BRANCH_HINT_RECORD(x, false)) [[unlikely]]
+
+#endif // SOLID_PROFILE_BRANCH_HINTS
+
 #ifndef LIKELY_ATTRIBUTE
 #define LIKELY_ATTRIBUTE [[likely]]
 #endif // LIKELY_ATTRIBUTE
@@ -310,6 +454,11 @@ namespace Solid
 #undef UNLIKELY
 #endif // UNLIKELY
 
+#if SOLID_PROFILE_BRANCH_HINTS
+#define LIKELY(x) SOLID_BRANCH_HINT_RECORD(x, true)
+#define UNLIKELY(x) SOLID_BRANCH_HINT_RECORD(x, false)
+#endif // SOLID_PROFILE_BRANCH_HINTS
+
 #ifndef LIKELY
 
 #if IS_MSVC
@@ -681,70 +830,139 @@ namespace Solid
 	#endif // IS_CLANG
 #endif // COLD_CODE_PATH
 
-/*namespace Solid::detail
-{
-	template<uint32 NumRuns, typename TestT>
-	void SolidBenchmark(const TCHAR* TestName, TestT&& TestBody)
-	{
-		UE_LOG(LogTemp, Log, TEXT("\n-------------------------------\n%s"), TestName);
-		double MinTime = TNumericLimits<double>::Max();
-		double TotalTime = 0;
-	
-		for (uint32 RunNo = 0; RunNo != NumRuns; ++RunNo)
-		{
-			double Time = FPlatformTime::Seconds();
-			TestBody();
-			Time = FPlatformTime::Seconds() - Time;
+// Hot path instrumentation on the dedicated SolidChannel Unreal Insights trace channel,
+// enable it with -trace=cpu,solid. With the channel disabled a scope costs a single branch.
 
-			const double Ms = (Time * 1000);
+// defines CPUPROFILERTRACE_ENABLED, CoreMinimal alone does not
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
-			UE_LOG(LogTemp, Warning, TEXT("#%d: %f secs (%f ms)"), RunNo, Time, Ms);
+#ifndef SOLID_TRACE_ENABLED
+	#if CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING
+	#define SOLID_TRACE_ENABLED 1
+	#else // CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING
+	#define SOLID_TRACE_ENABLED 0
+	#endif // CPUPROFILERTRACE_ENABLED && !UE_BUILD_SHIPPING
+#endif // SOLID_TRACE_ENABLED
 
-			TotalTime += Time;
+#if SOLID_TRACE_ENABLED
 
-			MinTime = std::min(MinTime, Time);
-		}
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Trace/Trace.h"
 
-		const double AverageTimeMs = (TotalTime / NumRuns) * 1000;
-		const double MinTimeMs = MinTime * 1000;
-	
-		UE_LOG(LogTemp, Warning,
-			TEXT("min: %f secs (%d ms), avg: %f secs (%f ms)\n-------------------------------\n"),
-			MinTime, static_cast<uint32>(MinTimeMs), TotalTime / NumRuns, AverageTimeMs);
-		UE_LOG(LogTemp, Warning,
-			TEXT("Microseconds: min: %f, avg: %f\n-------------------------------\n"),
-			MinTime * 1000000, (TotalTime / NumRuns) * 1000000);
-	}
-	
-} // namespace Solid::detail
+UE_TRACE_CHANNEL_EXTERN(SolidChannel, SOLIDMACROS_API);
+
+#define SOLID_TRACE_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(SolidChannel)
+
+#define SOLID_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, SolidChannel)
+#define SOLID_TRACE_SCOPE_STR(NameStr) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(NameStr, SolidChannel)
+#define SOLID_TRACE_SCOPE_TEXT(Name) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(Name, SolidChannel)
 
-#ifndef SOLID_BENCHMARK
-#define SOLID_BENCHMARK(NumRuns, ...) \
-	TRACE_CPUPROFILER_EVENT_SCOPE(TEXT(#__VA_ARGS__)); \
-	Solid::detail::SolidBenchmark<NumRuns>(TEXT(#__VA_ARGS__),
-#endif // SOLID_BENCHMARK*/
+// Counters and bookmarks are emitted through the engine's counter and bookmark events,
+// but are only recorded while SolidChannel is enabled as well.
+#define SOLID_TRACE_DECLARE_INT_COUNTER(CounterName, CounterDisplayName) \
+	TRACE_DECLARE_INT_COUNTER(CounterName, CounterDisplayName)
+
+#define SOLID_TRACE_DECLARE_FLOAT_COUNTER(CounterName, CounterDisplayName) \
+	TRACE_DECLARE_FLOAT_COUNTER(CounterName, CounterDisplayName)
+
+#define SOLID_TRACE_COUNTER_SET(CounterName, Value) \
+	do \
+	{ \
+		if (SOLID_TRACE_IS_ENABLED()) \
+		{ \
+			TRACE_COUNTER_SET(CounterName, Value); \
+		} \
+	} while (false)
+
+#define SOLID_TRACE_COUNTER_ADD(CounterName, Value) \
+	do \
+	{ \
+		if (SOLID_TRACE_IS_ENABLED()) \
+		{ \
+			TRACE_COUNTER_ADD(CounterName, Value); \
+		} \
+	} while (false)
+
+#define SOLID_TRACE_COUNTER_INCREMENT(CounterName) SOLID_TRACE_COUNTER_ADD(CounterName, 1)
+
+#define SOLID_TRACE_BOOKMARK(Format, ...) \
+	do \
+	{ \
+		if (SOLID_TRACE_IS_ENABLED()) \
+		{ \
+			TRACE_BOOKMARK(Format, ##__VA_ARGS__); \
+		} \
+	} while (false)
+
+#else // SOLID_TRACE_ENABLED
+
+#define SOLID_TRACE_IS_ENABLED() false
+
+#define SOLID_TRACE_SCOPE(Name)
+#define SOLID_TRACE_SCOPE_STR(NameStr)
+#define SOLID_TRACE_SCOPE_TEXT(Name)
+
+#define SOLID_TRACE_DECLARE_INT_COUNTER(CounterName, CounterDisplayName)
+#define SOLID_TRACE_DECLARE_FLOAT_COUNTER(CounterName, CounterDisplayName)
+#define SOLID_TRACE_COUNTER_SET(CounterName, Value) UE_EMPTY
+#define SOLID_TRACE_COUNTER_ADD(CounterName, Value) UE_EMPTY
+#define SOLID_TRACE_COUNTER_INCREMENT(CounterName) UE_EMPTY
+#define SOLID_TRACE_BOOKMARK(Format, ...) UE_EMPTY
+
+#endif // SOLID_TRACE_ENABLED
+
+// SOLID_BENCHMARK and the benchmark harness live in Benchmark/SolidBenchmark.h
+
+// Counts evaluations of each solid_check/solid_cassume site, see Solid.Checks.Dump.
+// Only counts by default, defining SOLID_PROFILE_CHECK_CYCLES to 1 (see SolidCheckProfiler.h) also times each site,
+// at the cost of two timestamp reads per evaluation.
+#ifndef SOLID_PROFILE_CHECKS
+#define SOLID_PROFILE_CHECKS 0
+#endif // SOLID_PROFILE_CHECKS
+
+#if SOLID_PROFILE_CHECKS && (!UE_BUILD_SHIPPING || USE_CHECKS_IN_SHIPPING)
+
+#include "Diagnostics/SolidCheckProfiler.h"
+
+#define SOLID_CHECK_PROFILE(expr) SOLID_CHECK_PROFILE_SITE(expr)
+
+#else // SOLID_PROFILE_CHECKS
+
+#define SOLID_CHECK_PROFILE(expr) UE_EMPTY
+
+#endif // SOLID_PROFILE_CHECKS
 
 #ifndef solid_check
 
 #if !UE_BUILD_SHIPPING || USE_CHECKS_IN_SHIPPING
 
 #define solid_check(expr) \
-	check(expr)
+	do \
+	{ \
+		SOLID_CHECK_PROFILE(expr); \
+		check(expr); \
+	} while (false)
 
 #define solid_checkf(expr, format, ...) \
-	checkf(expr, format, ##__VA_ARGS__)
+	do \
+	{ \
+		SOLID_CHECK_PROFILE(expr); \
+		checkf(expr, format, ##__VA_ARGS__); \
+	} while (false)
 
 #define solid_checkfmt(expr, format, ...) \
 	do \
 	{ \
-		UE_CHECK_F_IMPL(expr, TEXT("%s"), Solid::internal::BuildCheckTextFormat(format, ##__VA_ARGS__)); \
+		SOLID_CHECK_PROFILE(expr); \
+		UE_CHECK_F_IMPL(expr, TEXT("%s"), *Solid::internal::FCheckText(format, ##__VA_ARGS__)); \
 	} while (false)
 
 #define solid_ensure(expr) ensure(expr)
 #define solid_ensureMsgf(expr, format, ...) ensureMsgf(expr, format, ##__VA_ARGS__)
 
 #define solid_ensurefmt(expr, format, ...) \
-	UE_ENSURE_F_IMPL(expr, TEXT("%s"), Solid::internal::BuildCheckTextFormat(format, ##__VA_ARGS__))
+	UE_ENSURE_F_IMPL(expr, TEXT("%s"), *Solid::internal::FCheckText(format, ##__VA_ARGS__))
 
 #define solid_verify(expr) verify(expr)
 #define solid_verifyf(expr, format, ...) verifyf(expr, format, ##__VA_ARGS__)
@@ -752,19 +970,30 @@ namespace Solid
 #define solid_verifyfmt(expr, format, ...) \
 	do \
 	{ \
-		UE_CHECK_F_IMPL(expr, TEXT("%s"), Solid::internal::BuildCheckTextFormat(format, ##__VA_ARGS__)); \
+		UE_CHECK_F_IMPL(expr, TEXT("%s"), *Solid::internal::FCheckText(format, ##__VA_ARGS__)); \
 	} while (false)
 
 // Compiles down to an assume in shipping builds
-#define solid_cassume(expr) check(expr)
+#define solid_cassume(expr) \
+	do \
+	{ \
+		SOLID_CHECK_PROFILE(expr); \
+		check(expr); \
+	} while (false)
 
 // Compiles down to an assume in shipping builds
-#define solid_cassumef(expr, format, ...) checkf(expr, format, ##__VA_ARGS__)
+#define solid_cassumef(expr, format, ...) \
+	do \
+	{ \
+		SOLID_CHECK_PROFILE(expr); \
+		checkf(expr, format, ##__VA_ARGS__); \
+	} while (false)
 
 #define solid_cassumefmt(expr, format, ...) \
 	do \
 	{ \
-		UE_CHECK_F_IMPL(expr, TEXT("%s"), Solid::internal::BuildCheckTextFormat(format, ##__VA_ARGS__)); \
+		SOLID_CHECK_PROFILE(expr); \
+		UE_CHECK_F_IMPL(expr, TEXT("%s"), *Solid::internal::FCheckText(format, ##__VA_ARGS__)); \
 	} while (false)
 
 #else // UE_BUILD_SHIPPING || USE_CHECKS_IN_SHIPPING
@@ -806,3 +1035,74 @@ namespace Solid
 #ifndef SOLID_SELECT_ANY
 #define SOLID_SELECT_ANY UE_SELECT_ANY
 #endif // SOLID_SELECT_ANY
+
+#ifndef SOLID_CACHE_LINE_SIZE
+#define SOLID_CACHE_LINE_SIZE PLATFORM_CACHE_LINE_SIZE
+#endif // SOLID_CACHE_LINE_SIZE
+
+#ifndef SOLID_CACHE_ALIGNED
+#define SOLID_CACHE_ALIGNED alignas(SOLID_CACHE_LINE_SIZE)
+#endif // SOLID_CACHE_ALIGNED
+
+// Locality follows __builtin_prefetch, 0 for data used once up to 3 to keep it in every cache level.
+// Locality must be a constant expression.
+#ifndef SOLID_PREFETCH_READ
+
+#if IS_CLANG || IS_GNU
+
+#define SOLID_PREFETCH_READ(Ptr, Locality) __builtin_prefetch(static_cast<const void*>(Ptr), 0, Locality)
+#define SOLID_PREFETCH_WRITE(Ptr, Locality) __builtin_prefetch(static_cast<const void*>(Ptr), 1, Locality)
+
+#elif IS_MSVC && PLATFORM_CPU_X86_FAMILY
+
+#include <xmmintrin.h>
+
+// _MM_HINT_NTA is 0, _MM_HINT_T2 to _MM_HINT_T0 are 3 to 1
+#define SOLID_PREFETCH_READ(Ptr, Locality) \
+	_mm_prefetch(reinterpret_cast<const char*>(Ptr), (Locality) == 0 ? _MM_HINT_NTA : 4 - (Locality))
+#define SOLID_PREFETCH_WRITE(Ptr, Locality) SOLID_PREFETCH_READ(Ptr, Locality)
+
+#else // IS_CLANG || IS_GNU
+
+#define SOLID_PREFETCH_READ(Ptr, Locality) FPlatformMisc::Prefetch(Ptr)
+#define SOLID_PREFETCH_WRITE(Ptr, Locality) FPlatformMisc::Prefetch(Ptr)
+
+#endif // IS_CLANG || IS_GNU
+
+#endif // SOLID_PREFETCH_READ
+
+// Compiles one function for a specific instruction set, e.g. SOLID_TARGET("avx2,bmi2").
+// The caller is responsible for only calling it on CPUs that support it, see Solid::FCpuFeatures.
+// MSVC emits any intrinsic without a target attribute, so it expands to nothing there.
+#ifndef SOLID_TARGET
+
+#if (IS_CLANG || IS_GNU) && PLATFORM_CPU_X86_FAMILY
+
+#define SOLID_TARGET(isa) __attribute__((target(isa)))
+
+#else // (IS_CLANG || IS_GNU) && PLATFORM_CPU_X86_FAMILY
+
+#define SOLID_TARGET(isa)
+
+#endif // (IS_CLANG || IS_GNU) && PLATFORM_CPU_X86_FAMILY
+
+#endif // SOLID_TARGET
+
+// Function multiversioning, e.g. SOLID_TARGET_CLONES("avx2", "default").
+// The loader picks the best clone through an ifunc, which only exists on ELF platforms.
+// Everywhere else this expands to nothing and Solid::TCpuDispatch is the portable alternative.
+#ifndef SOLID_TARGET_CLONES
+
+#if (IS_CLANG || IS_GNU) && PLATFORM_CPU_X86_FAMILY && PLATFORM_LINUX
+
+#define SOLID_HAS_TARGET_CLONES 1
+#define SOLID_TARGET_CLONES(...) __attribute__((target_clones(__VA_ARGS__)))
+
+#else // (IS_CLANG || IS_GNU) && PLATFORM_CPU_X86_FAMILY && PLATFORM_LINUX
+
+#define SOLID_HAS_TARGET_CLONES 0
+#define SOLID_TARGET_CLONES(...)
+
+#endif // (IS_CLANG || IS_GNU) && PLATFORM_CPU_X86_FAMILY && PLATFORM_LINUX
+
+#endif // SOLID_TARGET_CLONES